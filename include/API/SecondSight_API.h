@@ -0,0 +1,138 @@
+#pragma once
+#include <functional>
+#include <stdint.h>
+
+/*
+* For modders: Copy this file into your own project if you wish to use this API
+*/
+namespace SecondSight_API {
+	constexpr const auto SecondSightPluginName = "SecondSight";
+
+	// SKSE Messaging Interface - Effect Event Types
+	// Consumers can register a listener with SKSE::GetMessagingInterface()->RegisterListener()
+	// and receive these messages from SecondSight
+	enum class SecondSightMessage : uint32_t {
+		// Dispatched when the camera starts moving towards the target
+		// Data: SecondSightEventData*
+		kEffectStart = 0,
+
+		// Dispatched when the camera has arrived at the target and starts tracking it
+		// Data: SecondSightEventData*
+		kArrivedAtTarget = 1,
+
+		// Dispatched when the camera starts returning to its original position
+		// Data: SecondSightEventData*
+		kReturnStart = 2,
+
+		// Dispatched when the effect has ended and the camera is back at its original position
+		// Data: SecondSightEventData*
+		kEffectStop = 3,
+
+		// Dispatched when the effect switches to a new target without returning first
+		// Data: SecondSightEventData*
+		kTargetChanged = 4
+	};
+
+	// Event data structure for effect events
+	// Cast the 'data' parameter in your message handler to this type
+	struct SecondSightEventData {
+		RE::Actor* target;  // current target, may be nullptr on kEffectStop
+	};
+
+	// Current phase of the effect
+	enum class EffectState : uint8_t {
+		kInactive,
+		kTransitionToTarget,
+		kAtTarget,
+		kTransitionToPrevious
+	};
+
+	// Amount of optional per-frame work SecondSight currently performs, lowered when frame time is over budget
+	enum class QualityTier : uint8_t {
+		kHigh,
+		kMedium,
+		kLow
+	};
+
+	// Available SecondSight interface versions
+	enum class InterfaceVersion : uint8_t {
+		V1
+	};
+
+	// SecondSight's modder interface
+	class IVSecondSight1 {
+	public:
+		/// <summary>
+		/// Get the thread ID SecondSight is running in.
+		/// You may compare this with the result of GetCurrentThreadId() to help determine
+		/// if you are using the correct thread.
+		/// </summary>
+		/// <returns>TID</returns>
+		[[nodiscard]] virtual unsigned long GetSecondSightThreadId() const noexcept = 0;
+
+		/// <summary>
+		/// Get the SecondSight plugin version as an integer.
+		/// Encoded as: major * 10000 + minor * 100 + patch
+		/// Example: version 1.2.3 returns 10203
+		/// </summary>
+		/// <returns>Version encoded as integer</returns>
+		[[nodiscard]] virtual int GetSecondSightPluginVersion() const noexcept = 0;
+
+		/// <summary>
+		/// Start the Second Sight effect on the explicit target (see SetTarget),
+		/// or on the target selected via DTR, TDM or the crosshair.
+		/// While another plugin plays an FCFW timeline the request is queued and started once that playback stops.
+		/// Must be called from the main thread.
+		/// </summary>
+		/// <returns>True if the effect was started, false if it was queued or could not be started</returns>
+		[[nodiscard]] virtual bool StartEffect() const noexcept = 0;
+
+		/// <summary>
+		/// Return the camera to its original position and end the effect.
+		/// Must be called from the main thread.
+		/// </summary>
+		virtual void StopEffect() const noexcept = 0;
+
+		/// <summary>
+		/// Set an explicit target for the next StartEffect call, overriding DTR, TDM and the crosshair.
+		/// Pass nullptr to clear it.
+		/// </summary>
+		/// <param name="a_target">The target actor</param>
+		virtual void SetTarget(RE::Actor* a_target) const noexcept = 0;
+
+		/// <summary>
+		/// Get the actor the effect is currently looking at.
+		/// </summary>
+		/// <returns>Pointer to the target actor, or nullptr if the effect is not active</returns>
+		[[nodiscard]] virtual RE::Actor* GetTarget() const noexcept = 0;
+
+		/// <summary>
+		/// Get the current phase of the effect.
+		/// </summary>
+		/// <returns>The effect state</returns>
+		[[nodiscard]] virtual EffectState GetEffectState() const noexcept = 0;
+
+		/// <summary>
+		/// Get the quality tier selected by SecondSight's frame time governor.
+		/// </summary>
+		/// <returns>The current quality tier</returns>
+		[[nodiscard]] virtual QualityTier GetQualityTier() const noexcept = 0;
+	};
+
+	typedef void* (*_RequestPluginAPI)(const InterfaceVersion interfaceVersion);
+
+	/// <summary>
+	/// Request the SecondSight API interface.
+	/// Recommended: Send your request during or after SKSEMessagingInterface::kMessage_PostLoad to make sure the dll has already been loaded
+	/// </summary>
+	/// <param name="a_interfaceVersion">The interface version to request</param>
+	/// <returns>The pointer to the API singleton, or nullptr if request failed</returns>
+	[[nodiscard]] inline void* RequestPluginAPI(const InterfaceVersion a_interfaceVersion = InterfaceVersion::V1) {
+		auto pluginHandle = GetModuleHandle("SecondSight.dll");
+		_RequestPluginAPI requestAPIFunction = (_RequestPluginAPI)GetProcAddress(pluginHandle, "RequestPluginAPI");
+		if (requestAPIFunction) {
+			return requestAPIFunction(a_interfaceVersion);
+		}
+		return nullptr;
+	}
+}
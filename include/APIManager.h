@@ -13,5 +13,11 @@ struct APIs
 
     static inline TDM_API::IVTDM1* TrueDirectionalMovementV1 = nullptr;
 
+    // use the built-in camera driver even if FCFW is installed
+    static inline bool UseNativeCameraDriver = false;
+
 	static void RequestAPIs();
+
+	// Installs the built-in camera driver if FCFW is not available, call once all plugins are loaded
+	static void InstallFallbacks();
 };
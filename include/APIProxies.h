@@ -0,0 +1,242 @@
+#pragma once
+
+#include "API/FCFW_API.h"
+#include "API/DTR_API.h"
+#include "API/TrueDirectionalMovementAPI.h"
+
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <ostream>
+#include <utility>
+
+namespace SecondSight {
+
+    // Per-method call statistics of one proxied interface, indexed by the proxy's Method enum (kTotal sizes
+    // the table). Calls from a thread other than the interface's owning thread are counted separately and
+    // the first one per method is logged as an error.
+    template <class MethodType>
+    class CallStats {
+        public:
+            static constexpr size_t kMethodCount = static_cast<size_t>(MethodType::kTotal);
+
+            using MethodNames = std::array<std::pair<MethodType, const char*>, kMethodCount>;
+
+            CallStats(const char* a_interfaceName, const MethodNames& a_methodNames) :
+                m_interfaceName(a_interfaceName), m_methodNames(a_methodNames) {}
+
+            void SetOwnerThread(unsigned long a_threadID) { m_ownerThreadID = a_threadID; }
+
+            template <class F>
+            auto Call(MethodType a_method, F&& a_func) const {
+                Timer timer(*this, a_method);
+                return a_func();
+            }
+
+            const char* GetInterfaceName() const { return m_interfaceName; }
+
+            void Write(std::ostream& a_stream) const;
+
+            std::uint64_t GetActivationCalls() const { return m_activationCalls.load(std::memory_order_relaxed); }
+            std::uint64_t GetActivationNanoseconds() const { return m_activationNanoseconds.load(std::memory_order_relaxed); }
+            void ResetActivation() const {
+                m_activationCalls.store(0, std::memory_order_relaxed);
+                m_activationNanoseconds.store(0, std::memory_order_relaxed);
+            }
+
+        private:
+            struct Method {
+                std::atomic<std::uint64_t> calls = 0;
+                std::atomic<std::uint64_t> nanoseconds = 0;
+                std::atomic<std::uint64_t> maxNanoseconds = 0;
+                std::atomic<std::uint64_t> offThreadCalls = 0;
+            };
+
+            class Timer {
+                public:
+                    Timer(const CallStats& a_stats, MethodType a_method) :
+                        m_stats(a_stats), m_method(a_method), m_start(std::chrono::steady_clock::now()) {}
+                    ~Timer() {
+                        auto elapsed = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - m_start).count();
+                        m_stats.Record(m_method, static_cast<std::uint64_t>(elapsed));
+                    }
+
+                private:
+                    const CallStats& m_stats;
+                    MethodType m_method;
+                    std::chrono::steady_clock::time_point m_start;
+            };
+
+            void Record(MethodType a_method, std::uint64_t a_nanoseconds) const;
+
+            // members
+            const char* m_interfaceName;
+            MethodNames m_methodNames;
+            mutable std::array<Method, kMethodCount> m_methods;
+            mutable std::atomic<std::uint64_t> m_activationCalls = 0;
+            mutable std::atomic<std::uint64_t> m_activationNanoseconds = 0;
+            unsigned long m_ownerThreadID = 0;
+    }; // class CallStats
+
+    class FCFWProxy : public FCFW_API::IVFCFW1 {
+        public:
+            // one per proxied method, in declaration order; indexes stats
+            enum class Method : std::uint8_t {
+                kGetFCFWThreadId,
+                kGetFCFWPluginVersion,
+                kRegisterPlugin,
+                kRegisterTimeline,
+                kUnregisterTimeline,
+                kAddTranslationPoint,
+                kAddTranslationPointAtRef,
+                kAddTranslationPointAtCamera,
+                kAddRotationPoint,
+                kAddRotationPointAtRef,
+                kAddRotationPointAtCamera,
+                kRemoveTranslationPoint,
+                kRemoveRotationPoint,
+                kStartRecording,
+                kStopRecording,
+                kClearTimeline,
+                kGetTranslationPointCount,
+                kGetRotationPointCount,
+                kGetTranslationPoint,
+                kGetRotationPoint,
+                kStartPlayback,
+                kStopPlayback,
+                kSwitchPlayback,
+                kPausePlayback,
+                kResumePlayback,
+                kIsPlaybackRunning,
+                kIsRecording,
+                kIsPlaybackPaused,
+                kGetActiveTimelineID,
+                kAllowUserRotation,
+                kIsUserRotationAllowed,
+                kSetPlaybackMode,
+                kAddTimelineFromFile,
+                kExportTimeline,
+                kTotal
+            };
+
+            explicit FCFWProxy(FCFW_API::IVFCFW1* a_inner);
+
+            unsigned long GetFCFWThreadId() const noexcept override;
+            int GetFCFWPluginVersion() const noexcept override;
+            bool RegisterPlugin(SKSE::PluginHandle a_pluginHandle) const noexcept override;
+            size_t RegisterTimeline(SKSE::PluginHandle a_pluginHandle) const noexcept override;
+            bool UnregisterTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int AddTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_position, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddTranslationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddTranslationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::BSTPoint2<float>& a_rotation, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::BSTPoint2<float>& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            bool RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool StartRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_recordingInterval, bool a_append, float a_timeOffset) const noexcept override;
+            bool StopRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool ClearTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int GetTranslationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int GetRotationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            RE::NiPoint3 GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            RE::BSTPoint2<float> GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, bool a_followGround, float a_minHeightAboveGround, bool a_showMenusDuringPlayback) const noexcept override;
+            bool StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const noexcept override;
+            bool PausePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool ResumePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsPlaybackPaused(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            size_t GetActiveTimelineID() const noexcept override;
+            void AllowUserRotation(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_allow) const noexcept override;
+            bool IsUserRotationAllowed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool SetPlaybackMode(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, int a_playbackMode, float a_loopTimeOffset) const noexcept override;
+            bool AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset) const noexcept override;
+            bool ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const noexcept override;
+
+            CallStats<Method> stats;
+
+        private:
+            FCFW_API::IVFCFW1* m_inner;
+    }; // class FCFWProxy
+
+    class DTRProxy : public DTR_API::IVDTR1 {
+        public:
+            enum class Method : std::uint8_t {
+                kGetDTRThreadId,
+                kGetDTRPluginVersion,
+                kIsReticleActive,
+                kShowReticle,
+                kGetCurrentTarget,
+                kTotal
+            };
+
+            explicit DTRProxy(DTR_API::IVDTR1* a_inner);
+
+            unsigned long GetDTRThreadId() const noexcept override;
+            int GetDTRPluginVersion() const noexcept override;
+            bool IsReticleActive() const noexcept override;
+            void ShowReticle(bool a_show) const noexcept override;
+            RE::Actor* GetCurrentTarget() const noexcept override;
+
+            CallStats<Method> stats;
+
+        private:
+            DTR_API::IVDTR1* m_inner;
+    }; // class DTRProxy
+
+    class TDMProxy : public TDM_API::IVTDM1 {
+        public:
+            enum class Method : std::uint8_t {
+                kGetTDMThreadId,
+                kGetDirectionalMovementState,
+                kGetTargetLockState,
+                kGetCurrentTarget,
+                kRequestDisableDirectionalMovement,
+                kRequestDisableHeadtracking,
+                kGetDisableDirectionalMovementOwner,
+                kGetDisableHeadtrackingOwner,
+                kReleaseDisableDirectionalMovement,
+                kReleaseDisableHeadtracking,
+                kTotal
+            };
+
+            explicit TDMProxy(TDM_API::IVTDM1* a_inner);
+
+            unsigned long GetTDMThreadId() const noexcept override;
+            bool GetDirectionalMovementState() const noexcept override;
+            bool GetTargetLockState() const noexcept override;
+            TDM_API::ActorHandle GetCurrentTarget() const noexcept override;
+            TDM_API::APIResult RequestDisableDirectionalMovement(TDM_API::PluginHandle a_myPluginHandle) noexcept override;
+            TDM_API::APIResult RequestDisableHeadtracking(TDM_API::PluginHandle a_myPluginHandle) noexcept override;
+            TDM_API::PluginHandle GetDisableDirectionalMovementOwner() const noexcept override;
+            TDM_API::PluginHandle GetDisableHeadtrackingOwner() const noexcept override;
+            TDM_API::APIResult ReleaseDisableDirectionalMovement(TDM_API::PluginHandle a_myPluginHandle) noexcept override;
+            TDM_API::APIResult ReleaseDisableHeadtracking(TDM_API::PluginHandle a_myPluginHandle) noexcept override;
+
+            CallStats<Method> stats;
+
+        private:
+            TDM_API::IVTDM1* m_inner;
+    }; // class TDMProxy
+
+    // Optional decorators around the APIs:: interface pointers (INI EnableAPIProxies:Debug).
+    // Every call is forwarded, counted, timed and checked against the interface's owning thread.
+    namespace APIProxies {
+        void SetEnabled(bool a_enabled);
+
+        bool IsEnabled();
+
+        // Wraps the APIs:: pointers which are set and not yet wrapped
+        void Install();
+
+        // Logs the calls made since the last activation ended and resets the counters
+        void EndActivation();
+
+        // Writes the per-method statistics of the installed proxies and the cast queue statistics as CSV.
+        // Returns false if the file could not be written.
+        bool Dump(const std::filesystem::path& a_path);
+    } // namespace APIProxies
+} // namespace SecondSight
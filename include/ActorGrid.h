@@ -0,0 +1,61 @@
+#pragma once
+
+#include "ScreenProjection.h"
+#include "SpatialGrid.h"
+
+namespace SecondSight {
+
+    // Uniform 2D grid over the actors in the high and middle-high process lists, on top of SpatialGrid.
+    // Sync() runs once per frame from the player update and only moves actors whose position changed cells;
+    // cone and distance queries read the grid as of that sync and only visit the cells overlapping the query volume.
+    class ActorGrid {
+        public:
+            static ActorGrid& GetSingleton() {
+                static ActorGrid instance;
+                return instance;
+            }
+            ActorGrid(const ActorGrid&) = delete;
+            ActorGrid& operator=(const ActorGrid&) = delete;
+
+            static constexpr float kDefaultMaxDistance = 8000.f;
+            static constexpr float kAnchorHeight = 100.f;   // candidates are tested at chest height, the grid tracks the feet
+
+            // Called once per frame from PlayerCharacterHook::Update
+            void Sync();
+
+            void Clear();
+
+            // Returns the living actor closest to the view direction within a_maxAngle (degrees)
+            // and a_maxDistance (0 = default) of a_origin, ignoring the player and a_exclude.
+            // With a_camera, actors off screen are rejected as well. The candidates in the cells overlapping
+            // the cone are projected in one batch; only the survivors are resolved and checked.
+            RE::Actor* FindCrosshairTarget(const RE::NiPoint3& a_origin, const RE::NiPoint3& a_forward,
+                float a_maxDistance, float a_maxAngle, const RE::Actor* a_exclude = nullptr,
+                const ScreenProjection::Camera* a_camera = nullptr);
+
+            // Calls a_func(RE::Actor*) for every tracked actor within a_radius of a_center.
+            template <class F>
+            void ForEachInRadius(const RE::NiPoint3& a_center, float a_radius, F&& a_func) const {
+                m_grid.ForEachInRadius({ a_center.x, a_center.y, a_center.z }, a_radius, [&](SpatialGrid::ID a_id, const SpatialGrid::Point&) {
+                    if (auto actor = m_handles.at(a_id).get()) {
+                        a_func(actor.get());
+                    }
+                });
+            }
+
+            size_t GetActorCount() const { return m_grid.GetCount(); }
+
+        private:
+            ActorGrid() = default;
+            ~ActorGrid() = default;
+
+            void Track(RE::Actor* a_actor);
+
+            // members
+            SpatialGrid m_grid;
+            std::unordered_map<RE::FormID, RE::ActorHandle> m_handles;
+            ScreenProjection::Candidates m_candidates;     // reused by FindCrosshairTarget
+            std::vector<RE::FormID> m_candidateIDs;
+            ScreenProjection::Result m_projection;
+    }; // class ActorGrid
+} // namespace SecondSight
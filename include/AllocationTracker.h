@@ -0,0 +1,74 @@
+#pragma once
+
+#include <cstdint>
+
+namespace SecondSight {
+
+    // Counts heap allocations made by SecondSight on the calling thread. The counter is fed by the global
+    // operator new replacement in AllocationCounter.cpp, which is only compiled in with the CMake option
+    // SECONDSIGHT_TRACK_ALLOCATIONS; otherwise every call here is a no-op. Allocations made inside other
+    // modules (FCFW, the engine) use their own allocators and are not visible.
+    //
+    // The steady-state per-frame path must not allocate at all, an activation (casting the effect)
+    // must stay within kActivationBudget. Violations are logged as errors; the AllocationTest host target
+    // in tools/ runs the self-contained parts of both paths against the same counter and fails on them.
+    class AllocationTracker {
+        public:
+            static AllocationTracker& GetSingleton() {
+                static AllocationTracker instance;
+                return instance;
+            }
+            AllocationTracker(const AllocationTracker&) = delete;
+            AllocationTracker& operator=(const AllocationTracker&) = delete;
+
+#ifdef SECONDSIGHT_TRACK_ALLOCATIONS
+            static constexpr bool kEnabled = true;
+#else
+            static constexpr bool kEnabled = false;
+#endif
+            static constexpr std::uint64_t kActivationBudget = 64;
+
+            enum class Scope : std::uint8_t {
+                kFrame,
+                kActivation
+            };
+
+            // Allocations made on this thread since it started
+            static std::uint64_t GetThreadCount();
+
+            void Report(Scope a_scope, std::uint64_t a_count);
+
+            // Logs the frame statistics of the activation that just ended and resets them
+            void EndActivation();
+
+        private:
+            AllocationTracker() = default;
+            ~AllocationTracker() = default;
+
+            // members
+            std::uint64_t m_frames = 0;
+            std::uint64_t m_allocatingFrames = 0;
+            std::uint64_t m_frameAllocations = 0;
+    }; // class AllocationTracker
+
+    // Reports the allocations made on this thread while the scope is alive
+    class AllocationScope {
+        public:
+            explicit AllocationScope(AllocationTracker::Scope a_scope) : m_scope(a_scope) {
+                if constexpr (AllocationTracker::kEnabled) {
+                    m_start = AllocationTracker::GetThreadCount();
+                }
+            }
+            ~AllocationScope() {
+                if constexpr (AllocationTracker::kEnabled) {
+                    AllocationTracker::GetSingleton().Report(m_scope, AllocationTracker::GetThreadCount() - m_start);
+                }
+            }
+            AllocationScope(const AllocationScope&) = delete;
+            AllocationScope& operator=(const AllocationScope&) = delete;
+
+        private:
+            AllocationTracker::Scope m_scope;
+            std::uint64_t m_start = 0;
+    }; // class AllocationScope
+} // namespace SecondSight
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "DirectorQueue.h"
+
+namespace SecondSight {
+
+    // Spectator mode: SecondSight picks its own targets. Combat, hit, death and spell cast events add to
+    // the score of the actors involved (see DirectorQueue), and the director starts the effect on the best
+    // candidate and hops between candidates through the regular transition and at-target legs, respecting
+    // a minimum dwell time per target and a cooldown before revisiting one.
+    // Events only touch the actors they name; the per-frame cost is a timer unless a cut is evaluated.
+    class AutoDirector :
+        public RE::BSTEventSink<RE::TESCombatEvent>,
+        public RE::BSTEventSink<RE::TESHitEvent>,
+        public RE::BSTEventSink<RE::TESDeathEvent>,
+        public RE::BSTEventSink<RE::TESSpellCastEvent> {
+        public:
+            static AutoDirector& GetSingleton() {
+                static AutoDirector instance;
+                return instance;
+            }
+            AutoDirector(const AutoDirector&) = delete;
+            AutoDirector& operator=(const AutoDirector&) = delete;
+
+            void LoadSettings();
+
+            void RegisterEventSinks();
+
+            void SetEnabled(bool a_enabled);
+
+            bool IsEnabled() const { return m_isEnabled; }
+
+            // Call once per frame
+            void Update(float a_delta);
+
+            RE::BSEventNotifyControl ProcessEvent(const RE::TESCombatEvent* a_event, RE::BSTEventSource<RE::TESCombatEvent>*) override;
+            RE::BSEventNotifyControl ProcessEvent(const RE::TESHitEvent* a_event, RE::BSTEventSource<RE::TESHitEvent>*) override;
+            RE::BSEventNotifyControl ProcessEvent(const RE::TESDeathEvent* a_event, RE::BSTEventSource<RE::TESDeathEvent>*) override;
+            RE::BSEventNotifyControl ProcessEvent(const RE::TESSpellCastEvent* a_event, RE::BSTEventSource<RE::TESSpellCastEvent>*) override;
+
+        private:
+            AutoDirector() = default;
+            ~AutoDirector() = default;
+
+            void AddEvent(RE::TESObjectREFR* a_ref, DirectorQueue::EventType a_type);
+
+            void Cut();
+
+            static constexpr float kEvaluateInterval = 0.25f;   // seconds between cut evaluations
+            static constexpr float kMaxEventDistance = 8000.f;  // events further from the player are ignored
+            static constexpr float kRestartDelay = 2.f;         // seconds after a directed effect ended before the next start
+
+            // members
+            DirectorQueue m_queue;
+            bool m_isEnabled = false;
+            bool m_isDirecting = false;     // the active effect was started by the director
+            DirectorQueue::CandidateID m_current = 0;
+            float m_time = 0.f;
+            float m_lastCutTime = 0.f;
+            float m_idleUntil = 0.f;
+            float m_evaluateTimer = 0.f;
+    }; // class AutoDirector
+} // namespace SecondSight
@@ -0,0 +1,281 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <numbers>
+
+#include <emmintrin.h>
+
+// SSE-backed vector/quaternion math for the camera logic.
+// Self-contained (no CommonLib dependency); RE::NiPoint3 / RE::BSTPoint2<float> convert via the
+// templated From/To helpers, which copy the components unchanged.
+//
+// Rotation convention is Skyrim's camera convention: pitch (x) positive looks down,
+// yaw (z) is measured clockwise from +Y, forward = (sin(yaw)cos(pitch), cos(yaw)cos(pitch), -sin(pitch)).
+namespace SecondSight::CameraMath {
+
+    constexpr float kPi = std::numbers::pi_v<float>;
+    constexpr float kTwoPi = 2.f * kPi;
+
+    struct alignas(16) Vec4 {
+        __m128 v;
+
+        Vec4() : v(_mm_setzero_ps()) {}
+        explicit Vec4(__m128 a_v) : v(a_v) {}
+        Vec4(float a_x, float a_y, float a_z, float a_w) : v(_mm_set_ps(a_w, a_z, a_y, a_x)) {}
+
+        float X() const { return _mm_cvtss_f32(v); }
+        float Y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+        float Z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))); }
+        float W() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+        Vec4 operator+(const Vec4& a_rhs) const { return Vec4(_mm_add_ps(v, a_rhs.v)); }
+        Vec4 operator-(const Vec4& a_rhs) const { return Vec4(_mm_sub_ps(v, a_rhs.v)); }
+        Vec4 operator*(float a_scalar) const { return Vec4(_mm_mul_ps(v, _mm_set1_ps(a_scalar))); }
+        Vec4 operator-() const { return Vec4(_mm_sub_ps(_mm_setzero_ps(), v)); }
+    };
+
+    // horizontal sum of all four lanes, broadcast
+    inline __m128 HorizontalSum(__m128 a_v) {
+        __m128 shuf = _mm_shuffle_ps(a_v, a_v, _MM_SHUFFLE(2, 3, 0, 1));
+        __m128 sums = _mm_add_ps(a_v, shuf);
+        shuf = _mm_shuffle_ps(sums, sums, _MM_SHUFFLE(1, 0, 3, 2));
+        return _mm_add_ps(sums, shuf);
+    }
+
+    inline float Dot(const Vec4& a_lhs, const Vec4& a_rhs) {
+        return _mm_cvtss_f32(HorizontalSum(_mm_mul_ps(a_lhs.v, a_rhs.v)));
+    }
+
+    struct alignas(16) Vec3 {
+        __m128 v;  // w lane is kept at 0
+
+        Vec3() : v(_mm_setzero_ps()) {}
+        explicit Vec3(__m128 a_v) : v(a_v) {}
+        Vec3(float a_x, float a_y, float a_z) : v(_mm_set_ps(0.f, a_z, a_y, a_x)) {}
+
+        template <class T>
+        static Vec3 From(const T& a_point) { return Vec3(a_point.x, a_point.y, a_point.z); }
+
+        template <class T>
+        T To() const {
+            alignas(16) float out[4];
+            _mm_store_ps(out, v);
+            return T{ out[0], out[1], out[2] };
+        }
+
+        float X() const { return _mm_cvtss_f32(v); }
+        float Y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+        float Z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))); }
+
+        Vec3 operator+(const Vec3& a_rhs) const { return Vec3(_mm_add_ps(v, a_rhs.v)); }
+        Vec3 operator-(const Vec3& a_rhs) const { return Vec3(_mm_sub_ps(v, a_rhs.v)); }
+        Vec3 operator*(float a_scalar) const { return Vec3(_mm_mul_ps(v, _mm_set1_ps(a_scalar))); }
+        Vec3 operator/(float a_scalar) const { return Vec3(_mm_div_ps(v, _mm_set1_ps(a_scalar))); }
+        Vec3 operator-() const { return Vec3(_mm_sub_ps(_mm_setzero_ps(), v)); }
+    };
+
+    inline float Dot(const Vec3& a_lhs, const Vec3& a_rhs) {
+        return _mm_cvtss_f32(HorizontalSum(_mm_mul_ps(a_lhs.v, a_rhs.v)));
+    }
+
+    inline Vec3 Cross(const Vec3& a_lhs, const Vec3& a_rhs) {
+        __m128 lYZX = _mm_shuffle_ps(a_lhs.v, a_lhs.v, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 rYZX = _mm_shuffle_ps(a_rhs.v, a_rhs.v, _MM_SHUFFLE(3, 0, 2, 1));
+        __m128 c = _mm_sub_ps(_mm_mul_ps(a_lhs.v, rYZX), _mm_mul_ps(lYZX, a_rhs.v));
+        return Vec3(_mm_shuffle_ps(c, c, _MM_SHUFFLE(3, 0, 2, 1)));
+    }
+
+    inline float Length(const Vec3& a_v) { return std::sqrt(Dot(a_v, a_v)); }
+
+    inline Vec3 Normalize(const Vec3& a_v) {
+        float length = Length(a_v);
+        return length > 1e-6f ? a_v / length : Vec3();
+    }
+
+    inline Vec3 Lerp(const Vec3& a_from, const Vec3& a_to, float a_t) { return a_from + (a_to - a_from) * a_t; }
+
+    // Wraps an angle into [-pi, pi]
+    inline float NormalizeAngle(float a_angle) {
+        return a_angle - kTwoPi * std::nearbyint(a_angle / kTwoPi);
+    }
+
+    // Wraps a_count angles in place into [-pi, pi], four at a time
+    inline void NormalizeAngles(float* a_angles, size_t a_count) {
+        const __m128 twoPi = _mm_set1_ps(kTwoPi);
+        const __m128 invTwoPi = _mm_set1_ps(1.f / kTwoPi);
+        size_t i = 0;
+        for (; i + 4 <= a_count; i += 4) {
+            __m128 angles = _mm_loadu_ps(a_angles + i);
+            __m128 turns = _mm_cvtepi32_ps(_mm_cvtps_epi32(_mm_mul_ps(angles, invTwoPi)));  // round to nearest
+            _mm_storeu_ps(a_angles + i, _mm_sub_ps(angles, _mm_mul_ps(turns, twoPi)));
+        }
+        for (; i < a_count; ++i) {
+            a_angles[i] = NormalizeAngle(a_angles[i]);
+        }
+    }
+
+    struct PitchYaw {
+        float pitch = 0.f;
+        float yaw = 0.f;
+
+        // RE::BSTPoint2<float> rotation: x = pitch, y = yaw
+        template <class T>
+        static PitchYaw From(const T& a_rotation) { return PitchYaw{ a_rotation.x, a_rotation.y }; }
+
+        template <class T>
+        T To() const { return T{ pitch, yaw }; }
+    };
+
+    inline Vec3 ForwardFromPitchYaw(float a_pitch, float a_yaw) {
+        float cosPitch = std::cos(a_pitch);
+        return Vec3(std::sin(a_yaw) * cosPitch, std::cos(a_yaw) * cosPitch, -std::sin(a_pitch));
+    }
+
+    // Pitch/yaw looking along a_direction. Straight up/down keeps a_fallbackYaw, since yaw is undefined there.
+    inline PitchYaw LookAt(const Vec3& a_direction, float a_fallbackYaw = 0.f) {
+        Vec3 dir = Normalize(a_direction);
+        float horizontal = std::sqrt(dir.X() * dir.X() + dir.Y() * dir.Y());
+        PitchYaw result;
+        result.pitch = std::atan2(-dir.Z(), horizontal);
+        result.yaw = horizontal > 1e-5f ? std::atan2(dir.X(), dir.Y()) : a_fallbackYaw;
+        return result;
+    }
+
+    inline PitchYaw LookAt(const Vec3& a_from, const Vec3& a_to, float a_fallbackYaw = 0.f) {
+        return LookAt(a_to - a_from, a_fallbackYaw);
+    }
+
+    struct alignas(16) Quat {
+        __m128 v;  // x, y, z, w
+
+        Quat() : v(_mm_set_ps(1.f, 0.f, 0.f, 0.f)) {}
+        explicit Quat(__m128 a_v) : v(a_v) {}
+        Quat(float a_x, float a_y, float a_z, float a_w) : v(_mm_set_ps(a_w, a_z, a_y, a_x)) {}
+
+        float X() const { return _mm_cvtss_f32(v); }
+        float Y() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1))); }
+        float Z() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2))); }
+        float W() const { return _mm_cvtss_f32(_mm_shuffle_ps(v, v, _MM_SHUFFLE(3, 3, 3, 3))); }
+
+        static Quat FromAxisAngle(const Vec3& a_axis, float a_angle) {
+            Vec3 axis = Normalize(a_axis);
+            float s = std::sin(0.5f * a_angle);
+            return Quat(axis.X() * s, axis.Y() * s, axis.Z() * s, std::cos(0.5f * a_angle));
+        }
+
+        // yaw about -Z (clockwise from +Y), then pitch about the camera's right axis
+        static Quat FromPitchYaw(const PitchYaw& a_rotation) {
+            float sp = std::sin(-0.5f * a_rotation.pitch), cp = std::cos(-0.5f * a_rotation.pitch);
+            float sy = std::sin(-0.5f * a_rotation.yaw), cy = std::cos(-0.5f * a_rotation.yaw);
+            // qYaw(z) * qPitch(x)
+            return Quat(cy * sp, sy * sp, sy * cp, cy * cp);
+        }
+
+        Quat Conjugate() const { return Quat(_mm_xor_ps(v, _mm_set_ps(0.f, -0.f, -0.f, -0.f))); }
+
+        Quat operator*(const Quat& a_rhs) const {
+            float x1 = X(), y1 = Y(), z1 = Z(), w1 = W();
+            float x2 = a_rhs.X(), y2 = a_rhs.Y(), z2 = a_rhs.Z(), w2 = a_rhs.W();
+            return Quat(w1 * x2 + x1 * w2 + y1 * z2 - z1 * y2,
+                        w1 * y2 - x1 * z2 + y1 * w2 + z1 * x2,
+                        w1 * z2 + x1 * y2 - y1 * x2 + z1 * w2,
+                        w1 * w2 - x1 * x2 - y1 * y2 - z1 * z2);
+        }
+
+        Vec3 Rotate(const Vec3& a_v) const {
+            // v' = v + 2w(q x v) + 2(q x (q x v))
+            Vec3 q(_mm_and_ps(v, _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1))));
+            Vec3 t = Cross(q, a_v) * 2.f;
+            return a_v + t * W() + Cross(q, t);
+        }
+
+        Vec3 Forward() const { return Rotate(Vec3(0.f, 1.f, 0.f)); }
+
+        // Inverse of FromPitchYaw. Near straight up/down the yaw is recovered from the rotated up
+        // vector instead of the forward vector, so looking up at tall creatures does not flip the yaw.
+        PitchYaw ToPitchYaw() const {
+            Vec3 forward = Forward();
+            float fz = std::clamp(forward.Z(), -1.f, 1.f);
+            PitchYaw result;
+            result.pitch = -std::asin(fz);
+            if (std::abs(fz) < 0.9999f) {
+                result.yaw = std::atan2(forward.X(), forward.Y());
+            } else {
+                Vec3 up = Rotate(Vec3(0.f, 0.f, 1.f));
+                float s = fz < 0.f ? 1.f : -1.f;  // sign of sin(pitch)
+                result.yaw = std::atan2(s * up.X(), s * up.Y());
+            }
+            return result;
+        }
+    };
+
+    inline float Dot(const Quat& a_lhs, const Quat& a_rhs) {
+        return _mm_cvtss_f32(HorizontalSum(_mm_mul_ps(a_lhs.v, a_rhs.v)));
+    }
+
+    inline Quat Normalize(const Quat& a_q) {
+        float length = std::sqrt(Dot(a_q, a_q));
+        return length > 1e-6f ? Quat(_mm_div_ps(a_q.v, _mm_set1_ps(length))) : Quat();
+    }
+
+    inline Quat Slerp(const Quat& a_from, const Quat& a_to, float a_t) {
+        float cosTheta = Dot(a_from, a_to);
+        __m128 to = a_to.v;
+        if (cosTheta < 0.f) {
+            // take the shorter arc
+            to = _mm_sub_ps(_mm_setzero_ps(), to);
+            cosTheta = -cosTheta;
+        }
+
+        float wFrom, wTo;
+        if (cosTheta > 0.9995f) {
+            // nearly parallel, normalized lerp avoids dividing by sin(theta) ~ 0
+            wFrom = 1.f - a_t;
+            wTo = a_t;
+        } else {
+            float theta = std::acos(cosTheta);
+            float invSin = 1.f / std::sin(theta);
+            wFrom = std::sin((1.f - a_t) * theta) * invSin;
+            wTo = std::sin(a_t * theta) * invSin;
+        }
+        return Normalize(Quat(_mm_add_ps(_mm_mul_ps(a_from.v, _mm_set1_ps(wFrom)), _mm_mul_ps(to, _mm_set1_ps(wTo)))));
+    }
+
+    // log/exp of unit quaternions, used for the squad control points
+    inline Quat Log(const Quat& a_q) {
+        float w = std::clamp(a_q.W(), -1.f, 1.f);
+        float theta = std::acos(w);
+        float s = std::sin(theta);
+        float scale = s > 1e-6f ? theta / s : 1.f;
+        return Quat(a_q.X() * scale, a_q.Y() * scale, a_q.Z() * scale, 0.f);
+    }
+
+    inline Quat Exp(const Quat& a_q) {
+        float theta = std::sqrt(a_q.X() * a_q.X() + a_q.Y() * a_q.Y() + a_q.Z() * a_q.Z());
+        float scale = theta > 1e-6f ? std::sin(theta) / theta : 1.f;
+        return Quat(a_q.X() * scale, a_q.Y() * scale, a_q.Z() * scale, std::cos(theta));
+    }
+
+    // Inner control point for squad at a_q between a_prev and a_next
+    inline Quat SquadControlPoint(const Quat& a_prev, const Quat& a_q, const Quat& a_next) {
+        Quat inv = a_q.Conjugate();
+        Quat toNext = inv * (Dot(a_q, a_next) < 0.f ? Quat(_mm_sub_ps(_mm_setzero_ps(), a_next.v)) : a_next);
+        Quat toPrev = inv * (Dot(a_q, a_prev) < 0.f ? Quat(_mm_sub_ps(_mm_setzero_ps(), a_prev.v)) : a_prev);
+        __m128 sum = _mm_add_ps(Log(toNext).v, Log(toPrev).v);
+        return Normalize(a_q * Exp(Quat(_mm_mul_ps(sum, _mm_set1_ps(-0.25f)))));
+    }
+
+    // Spherical cubic interpolation from a_q0 to a_q1 with control points a_a, a_b
+    inline Quat Squad(const Quat& a_q0, const Quat& a_a, const Quat& a_b, const Quat& a_q1, float a_t) {
+        return Slerp(Slerp(a_q0, a_q1, a_t), Slerp(a_a, a_b, a_t), 2.f * a_t * (1.f - a_t));
+    }
+
+    // Blends two pitch/yaw rotations along the shortest rotation between the two (roll-free) camera frames.
+    // Mostly the great arc between the view directions; a half turn next to the pole turns about the vertical.
+    inline PitchYaw Slerp(const PitchYaw& a_from, const PitchYaw& a_to, float a_t) {
+        Quat q = Slerp(Quat::FromPitchYaw(a_from), Quat::FromPitchYaw(a_to), a_t);
+        return q.ToPitchYaw();
+    }
+} // namespace SecondSight::CameraMath
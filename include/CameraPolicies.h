@@ -0,0 +1,98 @@
+#pragma once
+
+#include "PolicyChain.h"
+#include "TransitionTiming.h"
+
+namespace SecondSight::Policies {
+
+    // What UpdateTarget knows when it asks the target chain
+    struct TargetQuery {
+        RE::ActorHandle explicitTarget;     // set through the mod API
+        const RE::Actor* exclude = nullptr;
+        float crosshairDistance = 0.f;      // 0 = ActorGrid default
+        float crosshairAngle = 7.f;         // degrees
+    };
+
+    template <class T>
+    concept TargetSource = ChainSource<T, TargetQuery, RE::Actor*>;
+
+    template <TargetSource... Sources>
+    using TargetChain = FirstOf<TargetQuery, RE::Actor*, Sources...>;
+
+    // The target set through SetExplicitTarget, while it resolves
+    struct ExplicitTargetSource {
+        static bool Select(const TargetQuery& a_query, RE::Actor*& a_out);
+    };
+
+    // The DTR reticle target while the reticle is active
+    struct DTRTargetSource {
+        static bool Select(const TargetQuery& a_query, RE::Actor*& a_out);
+    };
+
+    // The TDM lock-on target while a target lock is active
+    struct TDMTargetSource {
+        static bool Select(const TargetQuery& a_query, RE::Actor*& a_out);
+    };
+
+    // The actor closest to the camera's view direction, always decides
+    struct CrosshairTargetSource {
+        static bool Select(const TargetQuery& a_query, RE::Actor*& a_out);
+    };
+
+    // Returns the node the camera frames on an actor, or nullptr if the actor cannot be framed
+    template <class T>
+    concept AnchorPolicy = requires(RE::Actor* a_actor) {
+        { T::Get(a_actor) } -> std::same_as<RE::NiPointer<RE::NiAVObject>>;
+    };
+
+    // The bone of the race's body part Part, falling back to the race's generic target part (kTotal)
+    template <RE::BGSBodyPartDefs::LIMB_ENUM Part>
+    struct BodyPartAnchor {
+        static RE::NiPointer<RE::NiAVObject> Get(RE::Actor* a_actor);
+    };
+
+    // The root of the actor's 3D, for races without usable body parts
+    struct RootAnchor {
+        static RE::NiPointer<RE::NiAVObject> Get(RE::Actor* a_actor);
+    };
+
+    using HeadAnchor = BodyPartAnchor<RE::BGSBodyPartDefs::LIMB_ENUM::kHead>;
+    using TorsoAnchor = BodyPartAnchor<RE::BGSBodyPartDefs::LIMB_ENUM::kTorso>;
+
+    // A complete set of strategies for FreeCameraManager, composed at compile time: no virtual calls,
+    // each strategy is a static call or a plain member the compiler can inline.
+    template <class Targets, TransitionPolicy Timing, AnchorPolicy Framing>
+        requires requires(const TargetQuery& a_query) {
+            { Targets::Select(a_query) } -> std::same_as<RE::Actor*>;
+        }
+    struct CameraPolicies {
+        using TargetSelection = Targets;
+        using Transition = Timing;
+        using Anchor = Framing;
+    };
+
+    // explicit target -> DTR -> TDM -> crosshair, linear transition time, head framing
+    using ShippingPolicies = CameraPolicies<
+        TargetChain<ExplicitTargetSource, DTRTargetSource, TDMTargetSource, CrosshairTargetSource>,
+        TransitionTiming,
+        HeadAnchor>;
+
+    // ignores the targeting mods, for setups where their reticles disagree with the view
+    using CrosshairPolicies = CameraPolicies<
+        TargetChain<ExplicitTargetSource, CrosshairTargetSource>,
+        TransitionTiming,
+        HeadAnchor>;
+
+    // longer flights to nearby targets, framing the upper body
+    using CinematicPolicies = CameraPolicies<
+        TargetChain<ExplicitTargetSource, DTRTargetSource, TDMTargetSource, CrosshairTargetSource>,
+        BasicTransitionTiming<SqrtCurve>,
+        TorsoAnchor>;
+
+    // The composition the plugin is built with, see SECONDSIGHT_CAMERA_POLICIES in CMakeLists.txt
+#ifdef SECONDSIGHT_CAMERA_POLICIES
+    using ActivePolicies = SECONDSIGHT_CAMERA_POLICIES;
+#else
+    using ActivePolicies = ShippingPolicies;
+#endif
+} // namespace SecondSight::Policies
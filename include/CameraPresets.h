@@ -0,0 +1,87 @@
+#pragma once
+
+namespace SecondSight {
+
+    // Keyframe templates for the three camera legs, loaded from SKSE/Plugins/SecondSight_Presets.csv.
+    //
+    // CSV columns: Leg, Channel, Anchor, Time, EaseIn, EaseOut
+    //   Leg:     TransitionToTarget | AtTarget | TransitionToPrevious
+    //   Channel: Translation | Rotation
+    //   Anchor:  Camera        - current camera position/rotation
+    //            Target        - target anchor point (translation) / aligned with the target's heading (rotation)
+    //            TargetLookAt  - looking at the target (rotation only)
+    //            Return        - camera position/rotation captured when the effect started
+    //   Time:    fraction of the leg's duration, 0..1
+    //
+    // The validated presets are cached in SecondSight_Presets.bin, keyed by a hash of the CSV content,
+    // so later loads skip parsing. If the CSV is missing or invalid the built-in presets are used.
+    class CameraPresets {
+        public:
+            static CameraPresets& GetSingleton() {
+                static CameraPresets instance;
+                return instance;
+            }
+            CameraPresets(const CameraPresets&) = delete;
+            CameraPresets& operator=(const CameraPresets&) = delete;
+
+            enum class Leg : std::uint8_t {
+                kTransitionToTarget,
+                kAtTarget,
+                kTransitionToPrevious,
+                kTotal
+            };
+
+            enum class Channel : std::uint8_t {
+                kTranslation,
+                kRotation
+            };
+
+            enum class Anchor : std::uint8_t {
+                kCamera,
+                kTarget,
+                kTargetLookAt,
+                kReturn
+            };
+
+            struct Keyframe {
+                float time = 0.f;
+                Leg leg = Leg::kTransitionToTarget;
+                Channel channel = Channel::kTranslation;
+                Anchor anchor = Anchor::kCamera;
+                std::uint8_t easeIn = 1;
+                std::uint8_t easeOut = 1;
+            };
+            static_assert(std::is_trivially_copyable_v<Keyframe>);
+
+            void Load();
+
+            std::span<const Keyframe> GetLeg(Leg a_leg) const;
+
+        private:
+            CameraPresets() = default;
+            ~CameraPresets() = default;
+
+            static constexpr std::uint32_t kCacheMagic = 0x53535043;  // "CPSS"
+            static constexpr std::uint32_t kCacheVersion = 1;
+
+            struct CacheHeader {
+                std::uint32_t magic = kCacheMagic;
+                std::uint32_t version = kCacheVersion;
+                std::uint64_t contentHash = 0;
+                std::uint32_t keyframeCount = 0;
+            };
+
+            static std::uint64_t HashContent(std::string_view a_content);
+
+            bool LoadCache(std::uint64_t a_contentHash);
+            void WriteCache(std::uint64_t a_contentHash) const;
+            bool Parse(const std::string& a_content, std::vector<Keyframe>& a_keyframes) const;
+            bool Validate(const std::vector<Keyframe>& a_keyframes) const;
+            void SetKeyframes(std::vector<Keyframe> a_keyframes);
+            void LoadDefaults();
+
+            // members
+            std::vector<Keyframe> m_keyframes;  // sorted by leg, then time
+            std::array<size_t, static_cast<size_t>(Leg::kTotal) + 1> m_legOffsets{};
+    }; // class CameraPresets
+} // namespace SecondSight
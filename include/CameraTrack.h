@@ -0,0 +1,64 @@
+#pragma once
+
+#include "CameraMath.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SecondSight {
+
+    // Keyframed camera channel (translation, or pitch/yaw rotation) with FCFW's point semantics:
+    //   - a key's interpolation mode, easeIn and easeOut apply to its INCOMING segment (previous -> key)
+    //   - easeIn starts the segment slowly, easeOut ends it slowly
+    //   - kCubicHermite uses Catmull-Rom tangents over the neighbouring keys (non-uniform times)
+    // Rotation tracks store (pitch, yaw, 0); the yaw always takes the shorter way between keys.
+    // Self-contained (no CommonLib dependency), the built-in camera driver refreshes the values of
+    // reference- and camera-anchored keys with SetValue() before evaluating.
+    class CameraTrack {
+        public:
+            enum class Interpolation : std::uint8_t {
+                kNone,
+                kLinear,
+                kCubicHermite
+            };
+
+            struct Key {
+                float time = 0.f;
+                CameraMath::Vec3 value;
+                bool easeIn = false;
+                bool easeOut = false;
+                Interpolation interpolation = Interpolation::kCubicHermite;
+            };
+
+            explicit CameraTrack(bool a_isRotation = false) : m_isRotation(a_isRotation) {}
+
+            // Inserts the key sorted by time (after keys with the same time) and returns its index
+            size_t Add(const Key& a_key);
+
+            bool Remove(size_t a_index);
+
+            void Clear() { m_keys.clear(); }
+
+            size_t GetCount() const { return m_keys.size(); }
+
+            const Key& GetKey(size_t a_index) const { return m_keys[a_index]; }
+
+            void SetValue(size_t a_index, const CameraMath::Vec3& a_value) { m_keys[a_index].value = a_value; }
+
+            // Time of the last key
+            float GetDuration() const { return m_keys.empty() ? 0.f : m_keys.back().time; }
+
+            CameraMath::Vec3 Evaluate(float a_time) const;
+
+            // Shapes a segment parameter in [0, 1] according to the easing flags
+            static float Ease(float a_t, bool a_easeIn, bool a_easeOut);
+
+        private:
+            // value of key a_index, with the yaw unwrapped to be within pi of a_reference's yaw
+            CameraMath::Vec3 GetUnwrapped(size_t a_index, const CameraMath::Vec3& a_reference) const;
+
+            // members
+            std::vector<Key> m_keys;
+            bool m_isRotation = false;
+    }; // class CameraTrack
+} // namespace SecondSight
@@ -0,0 +1,68 @@
+#pragma once
+
+#include <chrono>
+#include <cstdint>
+#include <optional>
+#include <ostream>
+
+namespace SecondSight {
+
+    // An API cast waiting for the camera while another mod plays an FCFW timeline. Self-contained
+    // (no CommonLib dependency). Only casts through the SecondSight API wait: the director picks its next
+    // cut on its own, and the Papyrus casts play the effect script's intro and outro around the call.
+    // At most one request waits; a repeated cast replaces it but keeps its original age. The owner serves
+    // the queue when FCFW reports that playback stopped; nothing runs per frame, an expired request is
+    // dropped when the queue is touched.
+    class CastQueue {
+        public:
+            using Clock = std::chrono::steady_clock;
+
+            // Who asked for a cast, only kAPI casts are queued
+            enum class Source : std::uint8_t {
+                kPlayer,    // Papyrus, i.e. the player's hotkey
+                kRewind,    // Papyrus rewind cast
+                kAPI,       // other plugins through the SecondSight API
+                kDirector   // the auto-director
+            };
+
+            struct Request {
+                Clock::time_point enqueued;
+                Clock::time_point expires;
+            };
+
+            struct Stats {
+                std::uint64_t served = 0;
+                std::uint64_t failed = 0;       // popped, but the effect could not be started
+                std::uint64_t expired = 0;
+                std::uint64_t replaced = 0;
+                Clock::duration totalWait{};
+                Clock::duration maxWait{};
+            };
+
+            void Push(Clock::duration a_timeToLive, Clock::time_point a_now);
+
+            // Removes and returns the waiting request, if it is still valid. The owner reports the outcome
+            // with RecordServed() or RecordFailed(), the wait is only counted once the effect has started.
+            std::optional<Request> Pop(Clock::time_point a_now);
+
+            void RecordServed(const Request& a_request, Clock::time_point a_now);
+
+            void RecordFailed() { ++m_stats.failed; }
+
+            void Clear() { m_request.reset(); }
+
+            bool IsEmpty() const { return !m_request; }
+
+            const Stats& GetStats() const { return m_stats; }
+
+            // Rows in the API statistics CSV format (Interface,Method,Calls,TotalUs,AverageUs,MaxUs,OffThreadCalls)
+            void WriteStats(std::ostream& a_stream) const;
+
+        private:
+            void DropExpired(Clock::time_point a_now);
+
+            // members
+            std::optional<Request> m_request;
+            Stats m_stats;
+    }; // class CastQueue
+} // namespace SecondSight
@@ -0,0 +1,100 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+#include <unordered_map>
+#include <vector>
+
+namespace SecondSight {
+
+    // Target selection for the auto-director. Self-contained (no CommonLib dependency), candidates are
+    // plain ids, so it can be driven headlessly by synthetic event streams.
+    //
+    // Scores decay exponentially over time. Instead of decaying every candidate each tick, a score is
+    // stored as score * exp(t / halfLifeTau), which keeps the relative order of candidates constant as time
+    // passes: an event only touches its own candidate and pushes one heap entry. Outdated heap entries are
+    // skipped when they reach the top (lazy deletion), and the heap is compacted once it holds more than
+    // kCompactRatio entries per candidate, so its size stays proportional to the candidates, not the events.
+    class DirectorQueue {
+        public:
+            using CandidateID = std::uint32_t;
+
+            enum class EventType : std::uint8_t {
+                kCombatStart,
+                kHit,
+                kDeath,
+                kSpellCast
+            };
+
+            struct Settings {
+                float minDwell = 4.f;           // seconds on a target before the next cut
+                float cooldown = 12.f;          // seconds before cutting back to a target
+                float halfLife = 6.f;           // seconds for a score to halve
+                float switchRatio = 1.25f;      // a candidate must beat the current target by this factor
+                float minScore = 0.5f;          // candidates below this are dropped
+            };
+
+            DirectorQueue() = default;
+            explicit DirectorQueue(const Settings& a_settings) : m_settings(a_settings) {}
+
+            void Reset();
+
+            // a_weight is added to the candidate's current score
+            void AddScore(CandidateID a_id, float a_weight, float a_time);
+
+            // Default weight of an event for its subject
+            static float GetEventWeight(EventType a_type);
+
+            // The candidate can no longer be picked (dead, unloaded)
+            void Remove(CandidateID a_id);
+
+            // Current (decayed) score
+            float GetScore(CandidateID a_id, float a_time) const;
+
+            // Returns the candidate to cut to, if any. a_current is the target on screen (0 = none),
+            // a_lastCutTime the time of the last cut.
+            std::optional<CandidateID> SelectCut(CandidateID a_current, float a_lastCutTime, float a_time);
+
+            // Call when a cut was performed, starts the cooldown of the target that was left
+            void OnCut(CandidateID a_from, CandidateID a_to, float a_time);
+
+            // Skip the candidate until the cooldown has passed, e.g. when a cut to it failed
+            void SetCooldown(CandidateID a_id, float a_time);
+
+            size_t GetCandidateCount() const { return m_candidates.size(); }
+
+            size_t GetHeapSize() const { return m_heap.size(); }
+
+        private:
+            struct Candidate {
+                double key = 0.0;           // score * exp(time / tau), relative to m_epoch
+                std::uint32_t version = 0;  // from m_version, so entries of a removed and re-added candidate stay outdated
+                float cooldownUntil = -1.f;
+            };
+
+            struct HeapEntry {
+                double key;
+                CandidateID id;
+                std::uint32_t version;
+
+                bool operator<(const HeapEntry& a_rhs) const { return key < a_rhs.key; }
+            };
+
+            double ToKey(float a_score, float a_time) const;
+            float FromKey(double a_key, float a_time) const;
+            void Rebase(float a_time);
+            void Compact();
+            bool IsCurrent(const HeapEntry& a_entry) const;
+
+            static constexpr double kMaxExponent = 200.0;   // rebase before exp() overflows
+            static constexpr size_t kCompactRatio = 2;      // heap entries per candidate before stale ones are dropped
+
+            // members
+            Settings m_settings;
+            std::unordered_map<CandidateID, Candidate> m_candidates;
+            std::vector<HeapEntry> m_heap;
+            std::vector<HeapEntry> m_deferred;  // scratch for candidates on cooldown during SelectCut
+            float m_epoch = 0.f;
+            std::uint32_t m_version = 0;
+    }; // class DirectorQueue
+} // namespace SecondSight
@@ -0,0 +1,25 @@
+#pragma once
+
+namespace SecondSight {
+
+    // World state read by the per-frame camera logic. Captured once at the top of FreeCameraManager::Update(),
+    // so every consumer in the frame sees the same values and each engine getter runs once per frame.
+    // Pointers are only valid for the frame they were captured in.
+    struct FrameSnapshot {
+        std::uint32_t frame = 0;
+        float deltaTime = 0.f;
+
+        // camera
+        RE::FreeCameraState* freeCameraState = nullptr;    // nullptr unless the free camera is active
+        float worldFOV = 75.f;
+        RE::NiPoint3 cameraPos;
+        RE::BSTPoint2<float> cameraRotation;                // x = pitch, y = yaw
+        size_t activeTimelineID = 0;
+
+        // target
+        RE::Actor* target = nullptr;
+        RE::NiAVObject* target3D = nullptr;
+        bool isTargetLoaded = false;                        // 3D present and cell attached
+        float targetHeading = 0.f;
+    };
+} // namespace SecondSight
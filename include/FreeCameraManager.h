@@ -1,5 +1,16 @@
 #pragma once
 
+#include "API/SecondSight_API.h"
+#include "CameraPolicies.h"
+#include "CameraPresets.h"
+#include "CastQueue.h"
+#include "FrameSnapshot.h"
+#include "GroupFraming.h"
+#include "LongRangePlanner.h"
+#include "RewindBuffer.h"
+#include "SeqLock.h"
+#include "TransitionHandoff.h"
+
 namespace SecondSight {
     
     class FreeCameraManager {
@@ -11,6 +22,21 @@ namespace SecondSight {
             FreeCameraManager(const FreeCameraManager&) = delete;
             FreeCameraManager& operator=(const FreeCameraManager&) = delete;
 
+            enum class FramingMode : std::uint8_t {
+                kSingle,    // the target's head
+                kGroup,     // the target and the actors around it
+                kEyes       // through the target's eyes, locked to its head bone
+            };
+
+            // Effect state as of the last published frame, readable from any thread
+            struct Snapshot {
+                SecondSight_API::EffectState state = SecondSight_API::EffectState::kInactive;
+                RE::RefHandle target = 0;
+                size_t activeTimelineID = 0;
+                float legTimeLeft = 0.f;        // seconds until the current leg ends, < 0 while tracking the target
+                std::uint32_t frame = 0;
+            };
+
             static void FCFWMessageHandler(SKSE::MessagingInterface::Message* a_msg);
             static void DTRMessageHandler(SKSE::MessagingInterface::Message* a_msg);
 
@@ -18,15 +44,44 @@ namespace SecondSight {
 
             void Update();
 
-            bool StartSecondSightEffect();
+            // Queued while another mod plays an FCFW timeline, for API casts only
+            bool StartSecondSightEffect(CastQueue::Source a_source);
 
             void StopSecondSightEffect();
 
+            bool HopToNextTarget();
+
+            // Starts the effect with a replay of the target's recorded path over the last a_seconds
+            bool StartRewindEffect(float a_seconds);
+
+            void UpdatePrewarm(float a_delta);
+
+            RE::Actor* GetCrosshairTarget(float a_maxTargetDistance, float a_maxTargetScanAngle, const RE::Actor* a_exclude = nullptr);
+
+            void SetExplicitTarget(RE::Actor* a_target);
+
+            RE::Actor* GetEffectTarget() const;
+
+            SecondSight_API::EffectState GetEffectState() const;
+
+            void SetFramingMode(FramingMode a_mode);
+
+            // Call once per frame from the main thread
+            void PublishSnapshot(float a_delta);
+
+            Snapshot GetSnapshot() const { return m_snapshot.Load(); }
+
+            void WriteCastQueueStats(std::ostream& a_stream) const { m_castQueue.WriteStats(a_stream); }
+
         private:
             FreeCameraManager() = default;
             ~FreeCameraManager() = default;
 
-            void UpdateTarget();
+            void UpdateTarget(const RE::Actor* a_exclude = nullptr);
+
+            RE::Actor* GetTarget() const { return m_target.get().get(); }
+
+            void LoadSettings();
 
             void ToggleFreeCamera();
 
@@ -34,24 +89,65 @@ namespace SecondSight {
 
             void ReturnToPrevious();
 
+            void ServeCastQueue();
+
             bool UpdateTimeline1();
             bool UpdateTimeline2();
             bool UpdateTimeline3();
 
-            bool InitializePlayback();
+            bool InitializePlayback(bool a_updateOffset = true);
+            bool UpdateTargetOffset();
             bool InitializeTimeline(size_t& a_timelineID);
+            bool AddRewindPoints(RE::Actor* a_target, size_t a_timelineID);
 
             bool IsPlaybackActive() const;
 
+            void RecordCameraSample();
+            bool EstimateCameraVelocity(RE::NiPoint3& a_linear, RE::BSTPoint2<float>& a_angular) const;
+            void AddPresetPoints(CameraPresets::Leg a_leg, size_t a_timelineID, float a_duration);
+
+            bool PrewarmTimelines();
+            bool IsPrewarmedFor(RE::ActorHandle a_target) const;
+            void InvalidatePrewarm();
+
             void ClampFreeRotation();
 
-            RE::NiPointer<RE::NiAVObject> GetCameraAnchorPoint();
+            void UpdateGroupMembers();
+            // a_snap places the camera at cast time, otherwise it blends towards the framing during Update()
+            bool UpdateGroupFraming(bool a_snap, float a_worldFOV, const RE::NiPoint3& a_cameraPos);
+            void ApplyGroupFraming();
+
+            static RE::NiTransform ComposeWorldTransform(RE::NiAVObject* a_node, const RE::NiAVObject* a_root);
+            bool ApplyEyesView();
+
+            RE::NiPointer<RE::NiAVObject> GetCameraAnchorPoint(RE::Actor* a_actor);
+
+            void UpdateLostTarget(RE::Actor* a_target);
+
+            void CaptureFrame();
+
+            SecondSight_API::EffectState GetEffectState(size_t a_activeTimelineID) const;
+
+            bool IsOwnTimeline(size_t a_timelineID) const;
+
+            void UpdateLongRangeStage();
+
+            // Traces how many frames the camera held at the end of the transition before the at-target timeline drove it
+            void UpdateHandoff();
+
+            // Arms the built-in camera driver to switch to the at-target timeline in the frame the transition ends
+            void ArmHandoff();
+
+            bool SwitchToAtTarget();
+
+            void DispatchEffectMessage(SecondSight_API::SecondSightMessage a_message) const;
 
             // members
             RE::CameraState m_previousCameraState;
             RE::NiPoint3 m_previousCameraPos;
             RE::NiPoint2 m_prevFreeRotation;
-            RE::Actor* m_target = nullptr;
+            RE::ActorHandle m_target;
+            RE::ActorHandle m_explicitTarget;   // set through the C++ API, overrides DTR/TDM/crosshair for the next cast or hop
             RE::BSTPoint2<float> m_prevRotation;
             RE::NiPoint3 m_offset;
             bool m_useReticleTarget = false;
@@ -60,5 +156,80 @@ namespace SecondSight {
             size_t m_transitionToTarget_TimelineID = 0;
             size_t m_atTarget_TimelineID = 0;
             size_t m_transitionToPrevious_TimelineID = 0;
+
+            struct CameraSample {
+                RE::NiPoint3 position;
+                RE::BSTPoint2<float> rotation;
+                float deltaTime = 0.f;
+            };
+            static constexpr size_t kCameraSampleCount = 4;
+            static constexpr float kVelocityLeadTime = 0.1f; // time of the keyframe carrying the initial camera velocity
+            static constexpr float kClampBlendRate = 20.f;   // 1/s, how fast the rotation eases into the clamp limit
+            std::array<CameraSample, kCameraSampleCount> m_cameraSamples;
+            size_t m_cameraSampleIndex = 0;
+            size_t m_cameraSampleCount = 0;
+            CameraMath::PitchYaw m_clampRotation;   // last clamped rotation, always within the range
+            std::uint32_t m_clampFrame = 0;
+
+            static constexpr float kPrewarmInterval = 0.25f;    // seconds between candidate checks
+            static constexpr float kPrewarmTolerance = 250.f;   // camera movement after which prewarmed timelines are stale
+            RE::ActorHandle m_prewarmedTarget;
+            RE::NiPoint3 m_prewarmedCameraPos;
+            bool m_isPrewarmValid = false;
+            float m_prewarmTimer = 0.f;
+
+            static constexpr float kGroupRadius = 1500.f;          // actors this close to the target join the group
+            static constexpr float kGroupRescanInterval = 1.f;     // seconds between group membership refreshes
+            static constexpr float kGroupFramingRate = 4.f;        // 1/s, how fast the camera follows the group
+            static constexpr float kGroupPitch = 0.25f;            // radians the camera looks down onto the group
+            static constexpr float kMinGroupRadius = 100.f;
+            static constexpr float kGroupAspectRatio = 16.f / 9.f; // used to derive the vertical FOV
+            FramingMode m_framingMode = FramingMode::kSingle;
+            GroupFraming m_groupFraming;
+            std::array<RE::ActorHandle, GroupFraming::kMaxPoints> m_groupMembers;  // parallel to the framing points
+            float m_groupRescanTimer = 0.f;
+            RE::NiPoint3 m_groupCameraPos;
+            CameraMath::PitchYaw m_groupCameraRotation;
+
+            static constexpr size_t kMaxBoneDepth = 32;
+            static constexpr float kEyeForwardOffset = 8.f;     // units in front of the head bone, along the gaze
+            static constexpr float kEyeUpOffset = 4.f;
+            RE::NiPoint3 m_eyesLocalForward;    // gaze direction in head bone space
+            RE::NiPoint3 m_eyesLocalOffset;     // eye position in head bone space
+            CameraMath::PitchYaw m_eyesRotation;
+            bool m_isEyesCalibrated = false;
+
+            static constexpr float kMaxTargetDistance = 8000.f;       // regular range, beyond it flights are staged
+            LongRange::Plan m_longRangePlan;
+            size_t m_longRangeStage = 0;
+            TransitionHandoff m_handoff;
+            FrameSnapshot m_frame;              // valid during Update()
+            std::uint32_t m_updateFrame = 0;
+
+            static constexpr float kRewindReplaySpeed = 1.5f;      // the recorded path plays back this much faster
+            static constexpr float kRewindCatchUpSpeed = 1500.f;   // units/s from the end of the replay to the live target
+            CastQueue m_castQueue;
+
+            float m_rewindSeconds = 0.f;        // history replayed by the next transition to the target, 0 = none
+            std::vector<RewindBuffer::Sample> m_rewindPath;
+
+            SeqLock<Snapshot> m_snapshot;
+            size_t m_snapshotTimelineID = 0;
+            float m_legElapsed = 0.f;
+            float m_transitionDuration = 0.f;
+            float m_returnDuration = 0.f;
+            std::uint32_t m_snapshotFrame = 0;
+
+            // settings
+            float m_targetGracePeriod = 1.5f;   // seconds the camera holds while the target's 3D is re-resolved
+            bool m_isLongRangeEnabled = true;
+            float m_longRangeMaxDistance = 30000.f;
+            float m_longRangeSpeed = 8000.f;    // units/s added to the transition beyond the saturation distance
+            Policies::ActivePolicies::Transition m_transitionTiming;
+            LongRange::Settings m_longRangeSettings;
+            float m_eyesStabilization = 0.f;    // 1/s, rotation smoothing in the eyes view, 0 = off
+            float m_castQueueTimeout = 10.f;    // seconds a cast waits for another mod's timeline, 0 = drop it
+
+            float m_lostTargetTime = -1.f;      // time since the target's 3D was lost, < 0 while the target is valid
     }; // class FreeCameraManager
 } // namespace SecondSight
@@ -0,0 +1,63 @@
+#pragma once
+
+#include "CameraMath.h"
+
+#include <array>
+#include <cstddef>
+
+namespace SecondSight {
+
+    // Bounding sphere and principal axis of a small group of points (actor anchors).
+    // Positions are stored SoA in 16-byte aligned lanes, so the radius pass runs four points per SSE op.
+    // First and second moments are updated incrementally as points move, the principal axis is a power
+    // iteration warm-started from the previous frame's axis. Moments are kept relative to a local origin
+    // in double precision to avoid cancellation at world coordinates; Rebuild() re-centres them.
+    class GroupFraming {
+        public:
+            static constexpr size_t kMaxPoints = 32;
+
+            struct Bounds {
+                CameraMath::Vec3 center;
+                CameraMath::Vec3 axis;  // unit length, sign is arbitrary
+                float radius = 0.f;
+                size_t count = 0;
+            };
+
+            void Clear();
+
+            // Recomputes the moments from the stored points around a new local origin
+            void Rebuild();
+
+            // Returns the index of the new point, or kMaxPoints if the group is full
+            size_t AddPoint(const CameraMath::Vec3& a_point);
+
+            void SetPoint(size_t a_index, const CameraMath::Vec3& a_point);
+
+            // Moves the last point into a_index
+            void RemovePoint(size_t a_index);
+
+            size_t GetCount() const { return m_count; }
+
+            Bounds Compute();
+
+        private:
+            struct Moments {
+                double x = 0.0, y = 0.0, z = 0.0;
+                double xx = 0.0, xy = 0.0, xz = 0.0, yy = 0.0, yz = 0.0, zz = 0.0;
+            };
+
+            void Accumulate(float a_x, float a_y, float a_z, double a_sign);
+            void FillPadding();
+
+            static constexpr size_t kPowerIterations = 4;
+
+            // members
+            alignas(16) std::array<float, kMaxPoints> m_x{};
+            alignas(16) std::array<float, kMaxPoints> m_y{};
+            alignas(16) std::array<float, kMaxPoints> m_z{};
+            size_t m_count = 0;
+            Moments m_moments;
+            CameraMath::Vec3 m_origin;
+            CameraMath::Vec3 m_axis{ 1.f, 0.f, 0.f };
+    }; // class GroupFraming
+} // namespace SecondSight
@@ -17,6 +17,20 @@ namespace Hooks
 		static inline REL::Relocation<decltype(Update)> _Update;
 	};
 
+	class PlayerCharacterHook
+	{
+	public:
+		static void Hook()
+		{
+			REL::Relocation<std::uintptr_t> PlayerCharacterVtbl{ RE::VTABLE_PlayerCharacter[0] };
+			_Update = PlayerCharacterVtbl.write_vfunc(0xAD, Update);
+		}
+
+	private:
+		static void Update(RE::PlayerCharacter* a_this, float a_delta);
+		static inline REL::Relocation<decltype(Update)> _Update;
+	};
+
 	void Install();
 } // namespace Hooks	
 
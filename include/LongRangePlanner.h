@@ -0,0 +1,39 @@
+#pragma once
+
+#include "CameraMath.h"
+
+#include <array>
+#include <cstddef>
+
+// Staged flight planning for targets beyond the regular transition range.
+// Self-contained (no CommonLib dependency) so plans can be built and checked off-game.
+namespace SecondSight::LongRange {
+
+    constexpr size_t kMaxStages = 8;
+
+    struct Settings {
+        float stageLength = 6000.f;     // maximum distance covered by one stage
+        float arcHeightRatio = 0.1f;    // apex of the flight arc, as a fraction of the distance
+        float maxArcHeight = 2000.f;
+    };
+
+    struct Stage {
+        CameraMath::Vec3 end;
+        float startTime = 0.f;
+        float endTime = 0.f;
+    };
+
+    struct Plan {
+        std::array<Stage, kMaxStages> stages;
+        size_t stageCount = 0;
+        float duration = 0.f;
+
+        // Index of the stage playing at a_elapsed seconds into the flight
+        size_t GetStage(float a_elapsed) const;
+    };
+
+    // Splits the flight from a_from to a_to into stages of at most a_settings.stageLength along an arc
+    // that rises over the terrain in between. a_duration is distributed over the stages by path length.
+    // The last stage ends at a_to.
+    Plan BuildPlan(const CameraMath::Vec3& a_from, const CameraMath::Vec3& a_to, float a_duration, const Settings& a_settings);
+} // namespace SecondSight::LongRange
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "API/SecondSight_API.h"
+
+namespace Messaging {
+
+    class SecondSightInterface : public SecondSight_API::IVSecondSight1 {
+        public:
+            static SecondSightInterface* GetSingleton() noexcept {
+                static SecondSightInterface singleton;
+                return &singleton;
+            }
+
+            // InterfaceVersion1
+            unsigned long GetSecondSightThreadId() const noexcept override;
+            int GetSecondSightPluginVersion() const noexcept override;
+            bool StartEffect() const noexcept override;
+            void StopEffect() const noexcept override;
+            void SetTarget(RE::Actor* a_target) const noexcept override;
+            RE::Actor* GetTarget() const noexcept override;
+            SecondSight_API::EffectState GetEffectState() const noexcept override;
+            SecondSight_API::QualityTier GetQualityTier() const noexcept override;
+
+        private:
+            SecondSightInterface() noexcept;
+            virtual ~SecondSightInterface() noexcept = default;
+
+            unsigned long apiTID = 0;
+    }; // class SecondSightInterface
+} // namespace Messaging
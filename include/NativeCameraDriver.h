@@ -0,0 +1,137 @@
+#pragma once
+
+#include "API/FCFW_API.h"
+#include "CameraTrack.h"
+#include "PlaybackClock.h"
+
+namespace SecondSight {
+
+    // Built-in implementation of the FCFW timeline interface, installed as APIs::FCFW when FreeCamera
+    // Framework is not present (or when UseNativeCameraDriver:Settings is set). Timelines are kept as
+    // CameraTrack pairs and played back in the FreeCameraState update hook, which writes the camera's
+    // translation and rotation directly. Playback events are delivered straight to
+    // FreeCameraManager::FCFWMessageHandler instead of through SKSE messaging. Beyond FCFW, the successor
+    // of a kWait timeline can be armed so the switch happens in the frame the end is reached (ArmSwitch).
+    //
+    // Covers what SecondSight uses: static, camera- and reference-anchored points, the kEnd/kLoop/kWait
+    // playback modes, speed/duration, global easing, pause/resume, switching and user rotation.
+    // Recording, timeline files, ground following and hiding menus are not supported.
+    class NativeCameraDriver : public FCFW_API::IVFCFW1 {
+        public:
+            static NativeCameraDriver& GetSingleton() {
+                static NativeCameraDriver instance;
+                return instance;
+            }
+            NativeCameraDriver(const NativeCameraDriver&) = delete;
+            NativeCameraDriver& operator=(const NativeCameraDriver&) = delete;
+
+            // Call from the FreeCameraState update hook
+            void Update(RE::FreeCameraState* a_state);
+
+            // Switches from a_fromTimelineID to a_toTimelineID in the frame the former reaches its end in kWait
+            // mode, kPlaybackWait is still sent for it. Fails if a_fromTimelineID is not playing here.
+            bool ArmSwitch(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const;
+
+            // IVFCFW1
+            unsigned long GetFCFWThreadId() const noexcept override;
+            int GetFCFWPluginVersion() const noexcept override;
+            bool RegisterPlugin(SKSE::PluginHandle a_pluginHandle) const noexcept override;
+            size_t RegisterTimeline(SKSE::PluginHandle a_pluginHandle) const noexcept override;
+            bool UnregisterTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int AddTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_position, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddTranslationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddTranslationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::BSTPoint2<float>& a_rotation, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::BSTPoint2<float>& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            int AddRotationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept override;
+            bool RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool StartRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_recordingInterval, bool a_append, float a_timeOffset) const noexcept override;
+            bool StopRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool ClearTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int GetTranslationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            int GetRotationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            RE::NiPoint3 GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            RE::BSTPoint2<float> GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept override;
+            bool StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, bool a_followGround, float a_minHeightAboveGround, bool a_showMenusDuringPlayback) const noexcept override;
+            bool StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const noexcept override;
+            bool PausePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool ResumePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool IsPlaybackPaused(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            size_t GetActiveTimelineID() const noexcept override;
+            void AllowUserRotation(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_allow) const noexcept override;
+            bool IsUserRotationAllowed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept override;
+            bool SetPlaybackMode(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, int a_playbackMode, float a_loopTimeOffset) const noexcept override;
+            bool AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset) const noexcept override;
+            bool ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const noexcept override;
+
+        private:
+            NativeCameraDriver();
+            ~NativeCameraDriver() = default;
+
+            using PlaybackMode = PlaybackClock::Mode;
+
+            struct PointSource {
+                enum class Kind : std::uint8_t {
+                    kStatic,
+                    kReference,
+                    kCamera
+                };
+
+                Kind kind = Kind::kStatic;
+                RE::ObjectRefHandle reference;
+                CameraMath::Vec3 offset;        // translation offset, or (pitch, yaw, 0) rotation offset
+                bool isOffsetRelative = false;
+            };
+
+            struct Timeline {
+                SKSE::PluginHandle owner = 0;
+                CameraTrack translation{ false };
+                CameraTrack rotation{ true };
+                std::vector<PointSource> translationSources;   // parallel to the track keys
+                std::vector<PointSource> rotationSources;
+                PlaybackMode playbackMode = PlaybackMode::kEnd;
+                float loopTimeOffset = 0.f;
+                bool allowUserRotation = false;
+
+                float GetDuration() const { return std::max(translation.GetDuration(), rotation.GetDuration()); }
+            };
+
+            struct Playback {
+                PlaybackClock clock;
+                bool globalEaseIn = false;
+                bool globalEaseOut = false;
+                bool isStopPending = false;     // kEnd mode reached the end, the stop is queued
+                CameraMath::Vec3 cameraPosition;   // captured when the timeline started, for camera-anchored points
+                CameraMath::Vec3 cameraRotation;
+                CameraMath::Vec3 writtenRotation;  // rotation written last frame, to pick up user input
+                CameraMath::Vec3 userRotation;     // accumulated user input while user rotation is allowed
+                bool hasWritten = false;
+            };
+
+            Timeline* GetTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const;
+
+            int AddPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_isRotation, const CameraTrack::Key& a_key, const PointSource& a_source) const;
+
+            void BeginTimeline(const PlaybackClock& a_clock) const;
+
+            void CaptureCamera() const;
+
+            void ResolveTranslation(Timeline& a_timeline) const;
+
+            void ResolveRotation(Timeline& a_timeline, const CameraMath::Vec3& a_cameraPosition) const;
+
+            static void Dispatch(FCFW_API::FCFWMessage a_message, size_t a_timelineID);
+
+            static CameraTrack::Interpolation ToInterpolation(int a_mode);
+
+            // members
+            unsigned long m_threadID = 0;
+            mutable std::unordered_map<size_t, Timeline> m_timelines;
+            mutable size_t m_nextTimelineID = 1;
+            mutable Playback m_playback;
+    }; // class NativeCameraDriver
+} // namespace SecondSight
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+namespace SecondSight {
+
+    // Playback clock of the built-in camera driver: advances the playing timeline by the frame time and applies
+    // its playback mode at the end. A kWait timeline can have its successor armed ahead of time, which then
+    // takes over in the frame the end is reached, played from the time left over past the end, instead of
+    // once the owner has handled kPlaybackWait.
+    // Self-contained (no CommonLib dependency), driven headless by tools/handoff/HandoffSim.
+    struct PlaybackClock {
+        enum class Mode : std::uint8_t {
+            kEnd,
+            kLoop,
+            kWait
+        };
+
+        enum class Event : std::uint8_t {
+            kNone,
+            kFinished,          // kEnd reached the end, the playback should stop
+            kWaitReached,       // kWait reached the end and holds there
+            kSwitched           // kWait reached the end and the armed timeline took over
+        };
+
+        size_t timelineID = 0;
+        float time = 0.f;
+        float speed = 1.f;
+        bool isPaused = false;
+        bool isWaiting = false;         // kWait mode reached the end
+        size_t armedTimelineID = 0;     // takes over at the end of a kWait timeline, 0 = none
+
+        // Advances by a_delta seconds of a timeline a_duration long. kFinished is reported every frame
+        // at the end, kWaitReached and kSwitched once.
+        Event Advance(float a_delta, float a_duration, Mode a_mode, float a_loopTimeOffset = 0.f);
+
+        // Restarts at the beginning of a_timelineID at the same speed
+        void Switch(size_t a_timelineID);
+
+        // a_timelineID takes over when the playing timeline reaches its end in kWait mode. Fails if nothing
+        // is playing or the end was already reached.
+        bool Arm(size_t a_timelineID);
+    };
+} // namespace SecondSight
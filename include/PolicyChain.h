@@ -0,0 +1,25 @@
+#pragma once
+
+#include <concepts>
+
+namespace SecondSight {
+
+    // A link of a FirstOf chain: Select() returns true if this source decides the result, which ends the
+    // chain even if a_out stays empty (e.g. a target lock on nothing). Returns false to defer to the next one.
+    template <class T, class Query, class Result>
+    concept ChainSource = requires(const Query& a_query, Result& a_out) {
+        { T::Select(a_query, a_out) } -> std::same_as<bool>;
+    };
+
+    // Asks Sources in order until one decides. The chain is a fold over static calls, resolved at compile time.
+    // Self-contained (no CommonLib dependency).
+    template <class Query, class Result, class... Sources>
+        requires(ChainSource<Sources, Query, Result> && ...)
+    struct FirstOf {
+        static Result Select(const Query& a_query) {
+            Result result{};
+            (Sources::Select(a_query, result) || ...);
+            return result;
+        }
+    };
+} // namespace SecondSight
@@ -0,0 +1,64 @@
+#pragma once
+
+#include "API/SecondSight_API.h"
+
+#include <chrono>
+
+namespace SecondSight {
+
+    // Tracks a moving window of measured frame times and steps SecondSight's optional per-frame work
+    // down when the average exceeds the target frame time, and back up once there is headroom again.
+    // Separate down/up thresholds plus a hold time after every change keep the tier from oscillating.
+    //   kHigh   - full quality
+    //   kMedium - target rescans at half rate
+    //   kLow    - target rescans at quarter rate, rotation clamp snaps instead of blending
+    class QualityGovernor {
+        public:
+            static QualityGovernor& GetSingleton() {
+                static QualityGovernor instance;
+                return instance;
+            }
+            QualityGovernor(const QualityGovernor&) = delete;
+            QualityGovernor& operator=(const QualityGovernor&) = delete;
+
+            using QualityTier = SecondSight_API::QualityTier;
+
+            void LoadSettings();
+
+            // Call once per frame
+            void OnFrame();
+
+            QualityTier GetTier() const { return m_tier; }
+
+            // Returns 0 if the clamp should snap instead of blending
+            float GetClampBlendRate(float a_baseRate) const;
+
+            float GetRescanInterval(float a_baseInterval) const;
+
+        private:
+            QualityGovernor() = default;
+            ~QualityGovernor() = default;
+
+            void SetTier(QualityTier a_tier, float a_averageFrameTime);
+
+            static constexpr size_t kWindowSize = 60;
+            static constexpr float kDowngradeRatio = 1.1f;  // step down above target * ratio
+            static constexpr float kUpgradeRatio = 0.8f;    // step up below target * ratio
+            static constexpr float kHoldTime = 2.f;         // seconds after a tier change before the next one
+            static constexpr float kMaxFrameDelta = 0.25f;  // longer frames are hitches or loading, not load
+
+            // members
+            std::array<float, kWindowSize> m_frameTimes{};
+            size_t m_frameIndex = 0;
+            size_t m_frameCount = 0;
+            double m_frameTimeSum = 0.0;
+            float m_holdTimer = 0.f;
+            std::chrono::steady_clock::time_point m_lastFrame;
+            bool m_hasLastFrame = false;
+            QualityTier m_tier = QualityTier::kHigh;
+
+            // settings
+            bool m_isEnabled = true;
+            float m_targetFrameTime = 1.f / 60.f;
+    }; // class QualityGovernor
+} // namespace SecondSight
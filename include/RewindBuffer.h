@@ -0,0 +1,104 @@
+#pragma once
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SecondSight {
+
+    // Rolling, compressed history of actor anchor positions and headings, used by rewind casts.
+    // Self-contained (no CommonLib dependency), tracks are keyed by plain ids.
+    //
+    // Every track owns a fixed ring of blocks, all allocated at construction, so memory is bounded by
+    // trackCount * blocksPerTrack * sizeof(Block). A block starts with a key sample (position quantized to
+    // kPositionStep units, heading to 1/65536 of a turn, time in milliseconds) followed by samples stored as
+    // zigzag varint deltas to the previous quantized sample, so the quantization error does not accumulate.
+    // When a track's ring is full its oldest block is overwritten; when all tracks are taken the least
+    // recently written one is reused.
+    class RewindBuffer {
+        public:
+            using TrackID = std::uint32_t;
+
+            struct Sample {
+                float time = 0.f;       // seconds
+                float x = 0.f;
+                float y = 0.f;
+                float z = 0.f;
+                float heading = 0.f;    // radians
+            };
+
+            struct Settings {
+                size_t trackCount = 48;
+                size_t blocksPerTrack = 16;
+            };
+
+            static constexpr float kPositionStep = 0.25f;       // game units per quantization step
+            static constexpr size_t kBlockSamples = 16;         // samples per block, including the key
+            static constexpr size_t kBlockBytes = 128;          // delta bytes per block
+
+            RewindBuffer() : RewindBuffer(Settings()) {}
+            explicit RewindBuffer(const Settings& a_settings);
+
+            void Clear();
+
+            // Samples must be recorded in increasing time per track
+            void Record(TrackID a_id, const Sample& a_sample);
+
+            void Remove(TrackID a_id);
+
+            bool HasTrack(TrackID a_id) const { return FindTrack(a_id) != kNoTrack; }
+
+            // Oldest and newest recorded time of the track
+            bool GetTimeRange(TrackID a_id, float& a_oldest, float& a_newest) const;
+
+            // Appends the decoded samples with a_from <= time <= a_to, oldest first. Returns the number appended.
+            size_t Decode(TrackID a_id, float a_from, float a_to, std::vector<Sample>& a_out) const;
+
+            size_t GetMemoryUsage() const;
+
+            // Encoded bytes and sample count over all tracks, for the compression ratio
+            size_t GetEncodedBytes() const;
+            size_t GetSampleCount() const;
+
+        private:
+            static constexpr size_t kNoTrack = static_cast<size_t>(-1);
+            static constexpr size_t kMaxSampleBytes = 3 + 3 * 5 + 3;    // time, position and heading varints
+
+            struct Quantized {
+                std::int64_t time = 0;     // milliseconds
+                std::int32_t x = 0;
+                std::int32_t y = 0;
+                std::int32_t z = 0;
+                std::uint16_t heading = 0;
+            };
+
+            struct Block {
+                Quantized key;
+                std::uint8_t count = 0;     // samples, including the key
+                std::uint8_t size = 0;      // used delta bytes
+                std::array<std::uint8_t, kBlockBytes> data{};
+            };
+
+            struct Track {
+                std::uint32_t firstBlock = 0;   // index into m_blocks
+                std::uint32_t head = 0;         // ring slot of the newest block
+                std::uint32_t blockCount = 0;   // valid blocks
+                std::int64_t lastWrite = 0;
+                Quantized last;
+            };
+
+            static Quantized Quantize(const Sample& a_sample);
+            static Sample Dequantize(const Quantized& a_quantized);
+
+            size_t FindTrack(TrackID a_id) const;
+            size_t ClaimTrack(TrackID a_id);
+            const Block& GetBlock(const Track& a_track, size_t a_age) const;  // age 0 = oldest
+
+            // members
+            Settings m_settings;
+            std::vector<TrackID> m_ids;         // parallel to m_tracks, 0 = unused
+            std::vector<Track> m_tracks;
+            std::vector<Block> m_blocks;
+    }; // class RewindBuffer
+} // namespace SecondSight
@@ -0,0 +1,48 @@
+#pragma once
+
+#include "RewindBuffer.h"
+
+namespace SecondSight {
+
+    // Samples the position and heading of actors near the player into a RewindBuffer, so a rewind cast
+    // can replay where its target has been. Sampling runs at a fixed interval from the player update,
+    // the frames in between only advance a timer.
+    class RewindRecorder {
+        public:
+            static RewindRecorder& GetSingleton() {
+                static RewindRecorder instance;
+                return instance;
+            }
+            RewindRecorder(const RewindRecorder&) = delete;
+            RewindRecorder& operator=(const RewindRecorder&) = delete;
+
+            void LoadSettings();
+
+            // Call once per frame
+            void Update(float a_delta);
+
+            // Drops all history, e.g. after loading a save
+            void Clear();
+
+            // Appends the samples of the last a_seconds for a_actor, oldest first.
+            // Returns false if fewer than two samples are available.
+            bool GetPath(const RE::Actor* a_actor, float a_seconds, std::vector<RewindBuffer::Sample>& a_out) const;
+
+            float GetMaxSeconds() const { return m_maxSeconds; }
+
+        private:
+            RewindRecorder() = default;
+            ~RewindRecorder() = default;
+
+            void Sample(RE::Actor* a_actor);
+
+            // members
+            RewindBuffer m_buffer;
+            bool m_isEnabled = true;
+            float m_sampleInterval = 0.1f;     // seconds
+            float m_radius = 4000.f;           // actors further from the player are not sampled
+            float m_maxSeconds = 10.f;         // longest rewind offered
+            float m_time = 0.f;
+            float m_sampleTimer = 0.f;
+    }; // class RewindRecorder
+} // namespace SecondSight
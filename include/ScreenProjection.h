@@ -0,0 +1,71 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SecondSight::ScreenProjection {
+
+    // The game's view: the world to camera (clip space) matrix and the viewport, as resolved in Offsets.h.
+    // Row-major, clip = worldToCam * (x, y, z, 1) as in NiCamera::WorldPtToScreenPt3.
+    struct Camera {
+        float worldToCam[4][4] = {};
+        float left = 0.f;
+        float right = 1.f;
+        float top = 1.f;
+        float bottom = 0.f;
+    };
+
+    // Candidate points in SoA layout, so the kernel loads eight of each coordinate at once.
+    // Clear() keeps the capacity.
+    struct Candidates {
+        std::vector<float> x;
+        std::vector<float> y;
+        std::vector<float> z;
+
+        void Clear() {
+            x.clear();
+            y.clear();
+            z.clear();
+        }
+
+        void Add(float a_x, float a_y, float a_z) {
+            x.push_back(a_x);
+            y.push_back(a_y);
+            z.push_back(a_z);
+        }
+
+        size_t Size() const { return x.size(); }
+    };
+
+    struct Query {
+        const Camera* camera = nullptr;     // nullptr = no screen test
+        float origin[3] = {};
+        float forward[3] = {};              // normalized
+        float maxDistance = 0.f;
+        float cosMaxAngle = -1.f;           // cone around forward
+        float screenMargin = 0.f;           // fraction of the half screen beyond the edges still counted as on screen
+    };
+
+    // Candidates that passed, in input order. The arrays only grow, the first count entries are valid.
+    struct Result {
+        std::vector<std::uint32_t> indices;
+        std::vector<float> cosAngle;
+        std::vector<float> distance;
+        std::vector<float> screenX;         // viewport coordinates, only with a camera
+        std::vector<float> screenY;
+        size_t count = 0;
+
+        void Reserve(size_t a_size);
+    };
+
+    // Rejects candidates behind the camera, off screen, outside the cone, further than maxDistance or
+    // closer than 1 unit. Uses the AVX2 kernel if the CPU supports it. Returns the number of survivors.
+    // Self-contained (no CommonLib dependency), shared with the benchmark in tools/.
+    size_t Project(const Query& a_query, const Candidates& a_candidates, Result& a_result);
+
+    size_t ProjectScalar(const Query& a_query, const Candidates& a_candidates, Result& a_result);
+    size_t ProjectAVX2(const Query& a_query, const Candidates& a_candidates, Result& a_result);
+
+    bool HasAVX2();
+} // namespace SecondSight::ScreenProjection
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+namespace SecondSight {
+
+    // Single-writer sequence lock for small trivially copyable values.
+    // Store() never waits, so the writing thread cannot be blocked by readers. Load() retries while a
+    // write is in progress (a few stores, so the retry is rare and short). The value is kept in relaxed
+    // atomic words, which keeps the concurrent copy well-defined.
+    template <class T>
+    class SeqLock {
+        static_assert(std::is_trivially_copyable_v<T> && std::is_default_constructible_v<T>);
+
+        public:
+            // Only one thread may call Store()
+            void Store(const T& a_value) {
+                std::array<Word, kWordCount> words{};
+                std::memcpy(words.data(), &a_value, sizeof(T));
+
+                auto sequence = m_sequence.load(std::memory_order_relaxed);
+                m_sequence.store(sequence + 1, std::memory_order_relaxed);
+                std::atomic_thread_fence(std::memory_order_release);
+                for (size_t i = 0; i < kWordCount; ++i) {
+                    m_words[i].store(words[i], std::memory_order_relaxed);
+                }
+                m_sequence.store(sequence + 2, std::memory_order_release);
+            }
+
+            // Safe to call from any thread
+            T Load() const {
+                std::array<Word, kWordCount> words;
+                for (;;) {
+                    auto sequence = m_sequence.load(std::memory_order_acquire);
+                    if (sequence & 1) {
+                        continue;
+                    }
+                    for (size_t i = 0; i < kWordCount; ++i) {
+                        words[i] = m_words[i].load(std::memory_order_relaxed);
+                    }
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if (m_sequence.load(std::memory_order_relaxed) == sequence) {
+                        break;
+                    }
+                }
+
+                T value;
+                std::memcpy(static_cast<void*>(&value), words.data(), sizeof(T));
+                return value;
+            }
+
+        private:
+            using Word = std::uint64_t;
+            static constexpr size_t kWordCount = (sizeof(T) + sizeof(Word) - 1) / sizeof(Word);
+
+            std::atomic<std::uint64_t> m_sequence{ 0 };
+            std::array<std::atomic<Word>, kWordCount> m_words{};
+    }; // class SeqLock
+} // namespace SecondSight
@@ -0,0 +1,124 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SecondSight {
+
+    // Uniform 2D grid over points keyed by plain ids (form ids in the game), the core of ActorGrid.
+    // Self-contained (no CommonLib dependency), shared with the benchmark in tools/.
+    //
+    // The grid is maintained from movement deltas: a sync pass (BeginSync, Update per live point, EndSync)
+    // only touches the cell lists of points that crossed a cell boundary and of points that are gone, so it
+    // is never rebuilt. Queries read the grid as it was left by the last pass and only visit the cells
+    // overlapping the query volume.
+    class SpatialGrid {
+        public:
+            using ID = std::uint32_t;
+
+            struct Point {
+                float x = 0.f;
+                float y = 0.f;
+                float z = 0.f;
+            };
+
+            static constexpr float kDefaultCellSize = 2048.f;
+
+            explicit SpatialGrid(float a_cellSize = kDefaultCellSize) : m_cellSize(a_cellSize) {}
+
+            // Entries not updated between BeginSync() and EndSync() are removed
+            void BeginSync() { ++m_generation; }
+
+            // Adds or moves a point. Returns true if it was added.
+            bool Update(ID a_id, const Point& a_position);
+
+            // Drops the entries not updated in this pass and returns their ids (valid until the next pass)
+            const std::vector<ID>& EndSync();
+
+            bool Remove(ID a_id);
+
+            void Clear();
+
+            size_t GetCount() const { return m_entries.size(); }
+
+            const Point* GetPosition(ID a_id) const {
+                auto it = m_entries.find(a_id);
+                return it != m_entries.end() ? &it->second.position : nullptr;
+            }
+
+            // Calls a_func(ID, const Point&) for every point in the cells overlapping the box, unfiltered
+            template <class F>
+            void ForEachInBox(float a_minX, float a_minY, float a_maxX, float a_maxY, F&& a_func) const {
+                const auto minCell = CellCoord(a_minX, a_minY);
+                const auto maxCell = CellCoord(a_maxX, a_maxY);
+                for (std::int32_t cx = minCell.first; cx <= maxCell.first; ++cx) {
+                    for (std::int32_t cy = minCell.second; cy <= maxCell.second; ++cy) {
+                        auto it = m_cells.find(CellKey(cx, cy));
+                        if (it == m_cells.end()) {
+                            continue;
+                        }
+                        for (auto id : it->second) {
+                            a_func(id, m_entries.at(id).position);
+                        }
+                    }
+                }
+            }
+
+            // Calls a_func(ID, const Point&) for every point within a_radius of a_center
+            template <class F>
+            void ForEachInRadius(const Point& a_center, float a_radius, F&& a_func) const {
+                const float radiusSq = a_radius * a_radius;
+                ForEachInBox(a_center.x - a_radius, a_center.y - a_radius, a_center.x + a_radius, a_center.y + a_radius,
+                    [&](ID a_id, const Point& a_position) {
+                        float dx = a_position.x - a_center.x;
+                        float dy = a_position.y - a_center.y;
+                        float dz = a_position.z - a_center.z;
+                        if (dx * dx + dy * dy + dz * dz <= radiusSq) {
+                            a_func(a_id, a_position);
+                        }
+                    });
+            }
+
+            // Calls a_func(ID, const Point&) for every point in the cells overlapping the bounding box of the cone
+            // from a_origin along a_forward (normalized), a_maxAngle degrees wide and a_maxDistance long.
+            // The cone test itself is left to the caller (ScreenProjection).
+            template <class F>
+            void ForEachNearCone(const Point& a_origin, const Point& a_forward, float a_maxDistance, float a_maxAngle, F&& a_func) const {
+                constexpr float kDegToRad = 3.14159265f / 180.f;
+                Point tip{ a_origin.x + a_forward.x * a_maxDistance, a_origin.y + a_forward.y * a_maxDistance, 0.f };
+                float spread = a_maxAngle > 90.f ? a_maxDistance : a_maxDistance * std::sin(std::max(a_maxAngle, 0.f) * kDegToRad);
+                ForEachInBox(std::min(a_origin.x, tip.x) - spread, std::min(a_origin.y, tip.y) - spread,
+                    std::max(a_origin.x, tip.x) + spread, std::max(a_origin.y, tip.y) + spread, a_func);
+            }
+
+        private:
+            struct Entry {
+                Point position;
+                std::int64_t cellKey = 0;
+                std::uint32_t generation = 0;
+            };
+
+            std::pair<std::int32_t, std::int32_t> CellCoord(float a_x, float a_y) const {
+                return { static_cast<std::int32_t>(std::floor(a_x / m_cellSize)),
+                         static_cast<std::int32_t>(std::floor(a_y / m_cellSize)) };
+            }
+
+            static std::int64_t CellKey(std::int32_t a_x, std::int32_t a_y) {
+                return (static_cast<std::int64_t>(a_x) << 32) | static_cast<std::uint32_t>(a_y);
+            }
+
+            void RemoveFromCell(ID a_id, std::int64_t a_cellKey);
+
+            // members
+            float m_cellSize = kDefaultCellSize;
+            std::unordered_map<ID, Entry> m_entries;
+            std::unordered_map<std::int64_t, std::vector<ID>> m_cells;
+            std::vector<ID> m_removed;
+            std::uint32_t m_generation = 0;
+    }; // class SpatialGrid
+} // namespace SecondSight
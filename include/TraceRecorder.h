@@ -0,0 +1,84 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <filesystem>
+#include <memory>
+
+namespace SecondSight {
+
+    // Records lifecycle events into a fixed-size ring buffer and dumps them as Chrome trace_event JSON
+    // (chrome://tracing, ui.perfetto.dev). Event names must be string literals, they are stored by pointer.
+    // While disabled every call is a single relaxed atomic load and no buffer is allocated.
+    class TraceRecorder {
+        public:
+            static TraceRecorder& GetSingleton() {
+                static TraceRecorder instance;
+                return instance;
+            }
+            TraceRecorder(const TraceRecorder&) = delete;
+            TraceRecorder& operator=(const TraceRecorder&) = delete;
+
+            static constexpr size_t kCapacity = 8192;
+
+            void SetEnabled(bool a_enabled);
+
+            bool IsEnabled() const { return m_enabled.load(std::memory_order_relaxed); }
+
+            void Begin(const char* a_name) {
+                if (IsEnabled()) {
+                    Record(a_name, 'B', 0);
+                }
+            }
+
+            void End(const char* a_name) {
+                if (IsEnabled()) {
+                    Record(a_name, 'E', 0);
+                }
+            }
+
+            void Instant(const char* a_name, std::uint64_t a_arg = 0) {
+                if (IsEnabled()) {
+                    Record(a_name, 'i', a_arg);
+                }
+            }
+
+            // Writes the buffered events, oldest first. Returns false if the file could not be written.
+            bool Dump(const std::filesystem::path& a_path) const;
+
+            void Clear() { m_next.store(0, std::memory_order_relaxed); }
+
+        private:
+            TraceRecorder() = default;
+            ~TraceRecorder() = default;
+
+            struct Event {
+                const char* name = nullptr;
+                std::int64_t timestamp = 0;  // microseconds since the recorder was enabled
+                std::uint64_t arg = 0;
+                std::uint32_t threadID = 0;
+                char phase = 'i';
+            };
+
+            void Record(const char* a_name, char a_phase, std::uint64_t a_arg);
+
+            // members
+            std::unique_ptr<Event[]> m_events;
+            std::atomic<std::uint64_t> m_next = 0;
+            std::atomic<bool> m_enabled = false;
+            std::chrono::steady_clock::time_point m_origin;
+    }; // class TraceRecorder
+
+    // Emits a begin/end pair for the enclosing scope
+    class TraceScope {
+        public:
+            explicit TraceScope(const char* a_name) : m_name(a_name) { TraceRecorder::GetSingleton().Begin(m_name); }
+            ~TraceScope() { TraceRecorder::GetSingleton().End(m_name); }
+            TraceScope(const TraceScope&) = delete;
+            TraceScope& operator=(const TraceScope&) = delete;
+
+        private:
+            const char* m_name;
+    }; // class TraceScope
+} // namespace SecondSight
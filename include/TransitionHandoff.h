@@ -0,0 +1,45 @@
+#pragma once
+
+#include <cstdint>
+#include <optional>
+
+namespace SecondSight {
+
+    // Handoff from the transition to the at-target timeline. Follows the transition's playback clock with the
+    // frame times the camera driver advances it by: every update still driven by the transition after that
+    // clock has passed the end of the leg is a frame the camera held the end pose. An armed handoff (the
+    // built-in driver, see PlaybackClock::Arm) is switched by the driver; otherwise the owner switches when
+    // kPlaybackWait arrives.
+    // Self-contained (no CommonLib dependency), driven headless by tools/handoff/HandoffSim.
+    class TransitionHandoff {
+        public:
+            enum class Action : std::uint8_t {
+                kNone,          // not handing off, or already arrived
+                kSwitch,        // switch the playback to the at-target timeline, then report the arrival
+                kArrive         // the camera driver has switched, report the arrival
+            };
+
+            // The transition leg started playing a_duration seconds of timeline
+            void Begin(float a_duration, bool a_isArmed);
+
+            // An update driven by the transition leg, after the driver advanced it by a_delta
+            void OnTransitionFrame(float a_delta);
+
+            // kPlaybackWait of the transition leg
+            Action OnPlaybackWait(bool a_isTransitionPlaying);
+
+            // The first update driven by the at-target timeline returns the frames the camera held at the end
+            // of the transition, later ones nothing
+            std::optional<std::uint32_t> OnAtTargetFrame();
+
+            float GetElapsed() const { return m_elapsed; }
+
+        private:
+            float m_duration = 0.f;
+            float m_elapsed = 0.f;              // seconds played of the transition
+            std::uint32_t m_heldFrames = 0;
+            bool m_isArmed = false;
+            bool m_isArrivalPending = false;    // kPlaybackWait not handled yet
+            bool m_isMeasuring = false;         // the at-target timeline has not played yet
+    }; // class TransitionHandoff
+} // namespace SecondSight
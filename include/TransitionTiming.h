@@ -0,0 +1,70 @@
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+
+namespace SecondSight {
+
+    // Shape of the duration curve between minDistance and maxDistance: maps the relative distance (0..1)
+    // to the relative time (0..1). Chosen at compile time, see CameraPolicies.h.
+    template <class T>
+    concept TransitionCurve = requires(float a_relDistance) {
+        { T::Map(a_relDistance) } -> std::convertible_to<float>;
+    };
+
+    // Constant speed across the range (shipping)
+    struct LinearCurve {
+        static float Map(float a_relDistance) { return a_relDistance; }
+    };
+
+    // Flat near both ends, so short hops and long flights cluster around minTime and maxTime
+    struct SmoothstepCurve {
+        static float Map(float a_relDistance) { return a_relDistance * a_relDistance * (3.f - 2.f * a_relDistance); }
+    };
+
+    // Rises quickly over short distances: nearby targets get more time, far ones comparatively less
+    struct SqrtCurve {
+        static float Map(float a_relDistance) { return std::sqrt(a_relDistance); }
+    };
+
+    // Duration of a camera flight over a distance: minTime up to minDistance, then rising along Curve to
+    // maxTime at maxDistance. Beyond maxDistance long range flights add (distance - maxDistance) / longRangeSpeed.
+    // Self-contained (no CommonLib dependency), shared with the offline autotuner in tools/.
+    template <TransitionCurve Curve>
+    struct BasicTransitionTiming {
+        using CurveType = Curve;
+
+        float minDistance = 2000.f;
+        float maxDistance = 10000.f;
+        float minTime = 0.5f;
+        float maxTime = 2.0f;
+
+        // a_longRangeSpeed <= 0 saturates at maxTime
+        float Compute(float a_distance, float a_longRangeSpeed = 0.f) const {
+            float relDistance = (a_distance - minDistance) / std::max(maxDistance - minDistance, 1.f);
+            relDistance = std::clamp(relDistance, 0.0f, 1.0f);
+
+            float transitionTime = minTime + (maxTime - minTime) * Curve::Map(relDistance);
+            if (a_longRangeSpeed > 0.f && a_distance > maxDistance) {
+                transitionTime += (a_distance - maxDistance) / a_longRangeSpeed;
+            }
+            return transitionTime;
+        }
+    };
+
+    using TransitionTiming = BasicTransitionTiming<LinearCurve>;
+
+    // Anything FreeCameraManager can use as its transition policy: configured from the [Transition] section
+    // and asked for the duration of each flight.
+    template <class T>
+    concept TransitionPolicy = std::default_initializable<T> && requires(T a_policy, float a_value) {
+        a_policy.minDistance = a_value;
+        a_policy.maxDistance = a_value;
+        a_policy.minTime = a_value;
+        a_policy.maxTime = a_value;
+        { a_policy.Compute(a_value, a_value) } -> std::convertible_to<float>;
+    };
+
+    static_assert(TransitionPolicy<TransitionTiming>);
+} // namespace SecondSight
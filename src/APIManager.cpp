@@ -1,7 +1,14 @@
 #include "APIManager.h"
+#include "APIProxies.h"
+#include "NativeCameraDriver.h"
 
 void APIs::RequestAPIs()
 {
+	if (!FCFW && UseNativeCameraDriver) {
+		FCFW = &SecondSight::NativeCameraDriver::GetSingleton();
+		log::info("Using the built-in camera driver instead of FCFW");
+	}
+
 	if (!FCFW) {
 		FCFW = reinterpret_cast<FCFW_API::IVFCFW1*>(FCFW_API::RequestPluginAPI(FCFW_API::InterfaceVersion::V1));
 		if (FCFW) {
@@ -27,5 +34,16 @@ void APIs::RequestAPIs()
 		}
 	}
 
+	SecondSight::APIProxies::Install();
+
+}
+
+void APIs::InstallFallbacks()
+{
+	if (!FCFW) {
+		FCFW = &SecondSight::NativeCameraDriver::GetSingleton();
+		log::info("FCFW not available, using the built-in camera driver");
+		SecondSight::APIProxies::Install();
+	}
 }
 
@@ -0,0 +1,422 @@
+#include "APIProxies.h"
+#include "APIManager.h"
+#include "FreeCameraManager.h"
+
+#include <fstream>
+
+namespace SecondSight {
+    template <class MethodType>
+    void CallStats<MethodType>::Record(MethodType a_method, std::uint64_t a_nanoseconds) const {
+        auto index = static_cast<size_t>(a_method);
+        auto& method = m_methods[index];
+        method.calls.fetch_add(1, std::memory_order_relaxed);
+        method.nanoseconds.fetch_add(a_nanoseconds, std::memory_order_relaxed);
+        auto max = method.maxNanoseconds.load(std::memory_order_relaxed);
+        while (a_nanoseconds > max && !method.maxNanoseconds.compare_exchange_weak(max, a_nanoseconds, std::memory_order_relaxed)) {
+        }
+        m_activationCalls.fetch_add(1, std::memory_order_relaxed);
+        m_activationNanoseconds.fetch_add(a_nanoseconds, std::memory_order_relaxed);
+
+        if (m_ownerThreadID != 0 && GetCurrentThreadId() != m_ownerThreadID) {
+            if (method.offThreadCalls.fetch_add(1, std::memory_order_relaxed) == 0) {
+                log::error("{}: {}::{} called from thread {}, owner is {}", __FUNCTION__, m_interfaceName, m_methodNames[index].second,
+                    GetCurrentThreadId(), m_ownerThreadID);
+            }
+        }
+    }
+
+    template <class MethodType>
+    void CallStats<MethodType>::Write(std::ostream& a_stream) const {
+        for (size_t i = 0; i < kMethodCount; ++i) {
+            auto& method = m_methods[i];
+            auto calls = method.calls.load(std::memory_order_relaxed);
+            if (calls == 0) {
+                continue;
+            }
+            auto nanoseconds = method.nanoseconds.load(std::memory_order_relaxed);
+            a_stream << m_interfaceName << ',' << m_methodNames[i].second << ',' << calls << ','
+                     << nanoseconds / 1000.0 << ',' << nanoseconds / 1000.0 / calls << ','
+                     << method.maxNanoseconds.load(std::memory_order_relaxed) / 1000.0 << ','
+                     << method.offThreadCalls.load(std::memory_order_relaxed) << '\n';
+        }
+    }
+
+    template class CallStats<FCFWProxy::Method>;
+    template class CallStats<DTRProxy::Method>;
+    template class CallStats<TDMProxy::Method>;
+
+    namespace {
+        // the name table lists every method once, in the order of the enum
+        template <class MethodType>
+        constexpr bool IsInMethodOrder(const typename CallStats<MethodType>::MethodNames& a_names) {
+            for (size_t i = 0; i < a_names.size(); ++i) {
+                if (static_cast<size_t>(a_names[i].first) != i || !a_names[i].second) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        using FCFWMethod = FCFWProxy::Method;
+
+        constexpr CallStats<FCFWMethod>::MethodNames kFCFWMethodNames{ {
+            { FCFWMethod::kGetFCFWThreadId, "GetFCFWThreadId" },
+            { FCFWMethod::kGetFCFWPluginVersion, "GetFCFWPluginVersion" },
+            { FCFWMethod::kRegisterPlugin, "RegisterPlugin" },
+            { FCFWMethod::kRegisterTimeline, "RegisterTimeline" },
+            { FCFWMethod::kUnregisterTimeline, "UnregisterTimeline" },
+            { FCFWMethod::kAddTranslationPoint, "AddTranslationPoint" },
+            { FCFWMethod::kAddTranslationPointAtRef, "AddTranslationPointAtRef" },
+            { FCFWMethod::kAddTranslationPointAtCamera, "AddTranslationPointAtCamera" },
+            { FCFWMethod::kAddRotationPoint, "AddRotationPoint" },
+            { FCFWMethod::kAddRotationPointAtRef, "AddRotationPointAtRef" },
+            { FCFWMethod::kAddRotationPointAtCamera, "AddRotationPointAtCamera" },
+            { FCFWMethod::kRemoveTranslationPoint, "RemoveTranslationPoint" },
+            { FCFWMethod::kRemoveRotationPoint, "RemoveRotationPoint" },
+            { FCFWMethod::kStartRecording, "StartRecording" },
+            { FCFWMethod::kStopRecording, "StopRecording" },
+            { FCFWMethod::kClearTimeline, "ClearTimeline" },
+            { FCFWMethod::kGetTranslationPointCount, "GetTranslationPointCount" },
+            { FCFWMethod::kGetRotationPointCount, "GetRotationPointCount" },
+            { FCFWMethod::kGetTranslationPoint, "GetTranslationPoint" },
+            { FCFWMethod::kGetRotationPoint, "GetRotationPoint" },
+            { FCFWMethod::kStartPlayback, "StartPlayback" },
+            { FCFWMethod::kStopPlayback, "StopPlayback" },
+            { FCFWMethod::kSwitchPlayback, "SwitchPlayback" },
+            { FCFWMethod::kPausePlayback, "PausePlayback" },
+            { FCFWMethod::kResumePlayback, "ResumePlayback" },
+            { FCFWMethod::kIsPlaybackRunning, "IsPlaybackRunning" },
+            { FCFWMethod::kIsRecording, "IsRecording" },
+            { FCFWMethod::kIsPlaybackPaused, "IsPlaybackPaused" },
+            { FCFWMethod::kGetActiveTimelineID, "GetActiveTimelineID" },
+            { FCFWMethod::kAllowUserRotation, "AllowUserRotation" },
+            { FCFWMethod::kIsUserRotationAllowed, "IsUserRotationAllowed" },
+            { FCFWMethod::kSetPlaybackMode, "SetPlaybackMode" },
+            { FCFWMethod::kAddTimelineFromFile, "AddTimelineFromFile" },
+            { FCFWMethod::kExportTimeline, "ExportTimeline" },
+        } };
+        static_assert(IsInMethodOrder<FCFWMethod>(kFCFWMethodNames));
+    }
+
+    unsigned long FCFWProxy::GetFCFWThreadId() const noexcept {
+        return stats.Call(FCFWMethod::kGetFCFWThreadId, [&] { return m_inner->GetFCFWThreadId(); });
+    }
+
+    int FCFWProxy::GetFCFWPluginVersion() const noexcept {
+        return stats.Call(FCFWMethod::kGetFCFWPluginVersion, [&] { return m_inner->GetFCFWPluginVersion(); });
+    }
+
+    bool FCFWProxy::RegisterPlugin(SKSE::PluginHandle a_pluginHandle) const noexcept {
+        return stats.Call(FCFWMethod::kRegisterPlugin, [&] { return m_inner->RegisterPlugin(a_pluginHandle); });
+    }
+
+    size_t FCFWProxy::RegisterTimeline(SKSE::PluginHandle a_pluginHandle) const noexcept {
+        return stats.Call(FCFWMethod::kRegisterTimeline, [&] { return m_inner->RegisterTimeline(a_pluginHandle); });
+    }
+
+    bool FCFWProxy::UnregisterTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kUnregisterTimeline, [&] { return m_inner->UnregisterTimeline(a_pluginHandle, a_timelineID); });
+    }
+
+    int FCFWProxy::AddTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_position, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddTranslationPoint, [&] { return m_inner->AddTranslationPoint(a_pluginHandle, a_timelineID, a_time, a_position, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    int FCFWProxy::AddTranslationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddTranslationPointAtRef, [&] { return m_inner->AddTranslationPointAtRef(a_pluginHandle, a_timelineID, a_time, a_reference, a_offset, a_isOffsetRelative, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    int FCFWProxy::AddTranslationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddTranslationPointAtCamera, [&] { return m_inner->AddTranslationPointAtCamera(a_pluginHandle, a_timelineID, a_time, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    int FCFWProxy::AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::BSTPoint2<float>& a_rotation, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddRotationPoint, [&] { return m_inner->AddRotationPoint(a_pluginHandle, a_timelineID, a_time, a_rotation, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    int FCFWProxy::AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::BSTPoint2<float>& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddRotationPointAtRef, [&] { return m_inner->AddRotationPointAtRef(a_pluginHandle, a_timelineID, a_time, a_reference, a_offset, a_isOffsetRelative, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    int FCFWProxy::AddRotationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        return stats.Call(FCFWMethod::kAddRotationPointAtCamera, [&] { return m_inner->AddRotationPointAtCamera(a_pluginHandle, a_timelineID, a_time, a_easeIn, a_easeOut, a_interpolationMode); });
+    }
+
+    bool FCFWProxy::RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        return stats.Call(FCFWMethod::kRemoveTranslationPoint, [&] { return m_inner->RemoveTranslationPoint(a_pluginHandle, a_timelineID, a_index); });
+    }
+
+    bool FCFWProxy::RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        return stats.Call(FCFWMethod::kRemoveRotationPoint, [&] { return m_inner->RemoveRotationPoint(a_pluginHandle, a_timelineID, a_index); });
+    }
+
+    bool FCFWProxy::StartRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_recordingInterval, bool a_append, float a_timeOffset) const noexcept {
+        return stats.Call(FCFWMethod::kStartRecording, [&] { return m_inner->StartRecording(a_pluginHandle, a_timelineID, a_recordingInterval, a_append, a_timeOffset); });
+    }
+
+    bool FCFWProxy::StopRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kStopRecording, [&] { return m_inner->StopRecording(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::ClearTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kClearTimeline, [&] { return m_inner->ClearTimeline(a_pluginHandle, a_timelineID); });
+    }
+
+    int FCFWProxy::GetTranslationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kGetTranslationPointCount, [&] { return m_inner->GetTranslationPointCount(a_pluginHandle, a_timelineID); });
+    }
+
+    int FCFWProxy::GetRotationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kGetRotationPointCount, [&] { return m_inner->GetRotationPointCount(a_pluginHandle, a_timelineID); });
+    }
+
+    RE::NiPoint3 FCFWProxy::GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        return stats.Call(FCFWMethod::kGetTranslationPoint, [&] { return m_inner->GetTranslationPoint(a_pluginHandle, a_timelineID, a_index); });
+    }
+
+    RE::BSTPoint2<float> FCFWProxy::GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        return stats.Call(FCFWMethod::kGetRotationPoint, [&] { return m_inner->GetRotationPoint(a_pluginHandle, a_timelineID, a_index); });
+    }
+
+    bool FCFWProxy::StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, bool a_followGround, float a_minHeightAboveGround, bool a_showMenusDuringPlayback) const noexcept {
+        return stats.Call(FCFWMethod::kStartPlayback, [&] { return m_inner->StartPlayback(a_pluginHandle, a_timelineID, a_speed, a_globalEaseIn, a_globalEaseOut, a_useDuration, a_duration, a_followGround, a_minHeightAboveGround, a_showMenusDuringPlayback); });
+    }
+
+    bool FCFWProxy::StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kStopPlayback, [&] { return m_inner->StopPlayback(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const noexcept {
+        return stats.Call(FCFWMethod::kSwitchPlayback, [&] { return m_inner->SwitchPlayback(a_pluginHandle, a_fromTimelineID, a_toTimelineID); });
+    }
+
+    bool FCFWProxy::PausePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kPausePlayback, [&] { return m_inner->PausePlayback(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::ResumePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kResumePlayback, [&] { return m_inner->ResumePlayback(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kIsPlaybackRunning, [&] { return m_inner->IsPlaybackRunning(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::IsRecording(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kIsRecording, [&] { return m_inner->IsRecording(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::IsPlaybackPaused(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kIsPlaybackPaused, [&] { return m_inner->IsPlaybackPaused(a_pluginHandle, a_timelineID); });
+    }
+
+    size_t FCFWProxy::GetActiveTimelineID() const noexcept {
+        return stats.Call(FCFWMethod::kGetActiveTimelineID, [&] { return m_inner->GetActiveTimelineID(); });
+    }
+
+    void FCFWProxy::AllowUserRotation(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_allow) const noexcept {
+        stats.Call(FCFWMethod::kAllowUserRotation, [&] { return m_inner->AllowUserRotation(a_pluginHandle, a_timelineID, a_allow); });
+    }
+
+    bool FCFWProxy::IsUserRotationAllowed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return stats.Call(FCFWMethod::kIsUserRotationAllowed, [&] { return m_inner->IsUserRotationAllowed(a_pluginHandle, a_timelineID); });
+    }
+
+    bool FCFWProxy::SetPlaybackMode(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, int a_playbackMode, float a_loopTimeOffset) const noexcept {
+        return stats.Call(FCFWMethod::kSetPlaybackMode, [&] { return m_inner->SetPlaybackMode(a_pluginHandle, a_timelineID, a_playbackMode, a_loopTimeOffset); });
+    }
+
+    bool FCFWProxy::AddTimelineFromFile(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath, float a_timeOffset) const noexcept {
+        return stats.Call(FCFWMethod::kAddTimelineFromFile, [&] { return m_inner->AddTimelineFromFile(a_pluginHandle, a_timelineID, a_filePath, a_timeOffset); });
+    }
+
+    bool FCFWProxy::ExportTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, const char* a_filePath) const noexcept {
+        return stats.Call(FCFWMethod::kExportTimeline, [&] { return m_inner->ExportTimeline(a_pluginHandle, a_timelineID, a_filePath); });
+    }
+
+    FCFWProxy::FCFWProxy(FCFW_API::IVFCFW1* a_inner) :
+        stats("FCFW", kFCFWMethodNames), m_inner(a_inner) {
+        stats.SetOwnerThread(m_inner->GetFCFWThreadId());
+    }
+
+    namespace {
+        using DTRMethod = DTRProxy::Method;
+
+        constexpr CallStats<DTRMethod>::MethodNames kDTRMethodNames{ {
+            { DTRMethod::kGetDTRThreadId, "GetDTRThreadId" },
+            { DTRMethod::kGetDTRPluginVersion, "GetDTRPluginVersion" },
+            { DTRMethod::kIsReticleActive, "IsReticleActive" },
+            { DTRMethod::kShowReticle, "ShowReticle" },
+            { DTRMethod::kGetCurrentTarget, "GetCurrentTarget" },
+        } };
+        static_assert(IsInMethodOrder<DTRMethod>(kDTRMethodNames));
+    }
+
+    unsigned long DTRProxy::GetDTRThreadId() const noexcept {
+        return stats.Call(DTRMethod::kGetDTRThreadId, [&] { return m_inner->GetDTRThreadId(); });
+    }
+
+    int DTRProxy::GetDTRPluginVersion() const noexcept {
+        return stats.Call(DTRMethod::kGetDTRPluginVersion, [&] { return m_inner->GetDTRPluginVersion(); });
+    }
+
+    bool DTRProxy::IsReticleActive() const noexcept {
+        return stats.Call(DTRMethod::kIsReticleActive, [&] { return m_inner->IsReticleActive(); });
+    }
+
+    void DTRProxy::ShowReticle(bool a_show) const noexcept {
+        stats.Call(DTRMethod::kShowReticle, [&] { return m_inner->ShowReticle(a_show); });
+    }
+
+    RE::Actor* DTRProxy::GetCurrentTarget() const noexcept {
+        return stats.Call(DTRMethod::kGetCurrentTarget, [&] { return m_inner->GetCurrentTarget(); });
+    }
+
+    DTRProxy::DTRProxy(DTR_API::IVDTR1* a_inner) :
+        stats("DTR", kDTRMethodNames), m_inner(a_inner) {
+        stats.SetOwnerThread(m_inner->GetDTRThreadId());
+    }
+
+    namespace {
+        using TDMMethod = TDMProxy::Method;
+
+        constexpr CallStats<TDMMethod>::MethodNames kTDMMethodNames{ {
+            { TDMMethod::kGetTDMThreadId, "GetTDMThreadId" },
+            { TDMMethod::kGetDirectionalMovementState, "GetDirectionalMovementState" },
+            { TDMMethod::kGetTargetLockState, "GetTargetLockState" },
+            { TDMMethod::kGetCurrentTarget, "GetCurrentTarget" },
+            { TDMMethod::kRequestDisableDirectionalMovement, "RequestDisableDirectionalMovement" },
+            { TDMMethod::kRequestDisableHeadtracking, "RequestDisableHeadtracking" },
+            { TDMMethod::kGetDisableDirectionalMovementOwner, "GetDisableDirectionalMovementOwner" },
+            { TDMMethod::kGetDisableHeadtrackingOwner, "GetDisableHeadtrackingOwner" },
+            { TDMMethod::kReleaseDisableDirectionalMovement, "ReleaseDisableDirectionalMovement" },
+            { TDMMethod::kReleaseDisableHeadtracking, "ReleaseDisableHeadtracking" },
+        } };
+        static_assert(IsInMethodOrder<TDMMethod>(kTDMMethodNames));
+    }
+
+    unsigned long TDMProxy::GetTDMThreadId() const noexcept {
+        return stats.Call(TDMMethod::kGetTDMThreadId, [&] { return m_inner->GetTDMThreadId(); });
+    }
+
+    bool TDMProxy::GetDirectionalMovementState() const noexcept {
+        return stats.Call(TDMMethod::kGetDirectionalMovementState, [&] { return m_inner->GetDirectionalMovementState(); });
+    }
+
+    bool TDMProxy::GetTargetLockState() const noexcept {
+        return stats.Call(TDMMethod::kGetTargetLockState, [&] { return m_inner->GetTargetLockState(); });
+    }
+
+    TDM_API::ActorHandle TDMProxy::GetCurrentTarget() const noexcept {
+        return stats.Call(TDMMethod::kGetCurrentTarget, [&] { return m_inner->GetCurrentTarget(); });
+    }
+
+    TDM_API::APIResult TDMProxy::RequestDisableDirectionalMovement(TDM_API::PluginHandle a_myPluginHandle) noexcept {
+        return stats.Call(TDMMethod::kRequestDisableDirectionalMovement, [&] { return m_inner->RequestDisableDirectionalMovement(a_myPluginHandle); });
+    }
+
+    TDM_API::APIResult TDMProxy::RequestDisableHeadtracking(TDM_API::PluginHandle a_myPluginHandle) noexcept {
+        return stats.Call(TDMMethod::kRequestDisableHeadtracking, [&] { return m_inner->RequestDisableHeadtracking(a_myPluginHandle); });
+    }
+
+    TDM_API::PluginHandle TDMProxy::GetDisableDirectionalMovementOwner() const noexcept {
+        return stats.Call(TDMMethod::kGetDisableDirectionalMovementOwner, [&] { return m_inner->GetDisableDirectionalMovementOwner(); });
+    }
+
+    TDM_API::PluginHandle TDMProxy::GetDisableHeadtrackingOwner() const noexcept {
+        return stats.Call(TDMMethod::kGetDisableHeadtrackingOwner, [&] { return m_inner->GetDisableHeadtrackingOwner(); });
+    }
+
+    TDM_API::APIResult TDMProxy::ReleaseDisableDirectionalMovement(TDM_API::PluginHandle a_myPluginHandle) noexcept {
+        return stats.Call(TDMMethod::kReleaseDisableDirectionalMovement, [&] { return m_inner->ReleaseDisableDirectionalMovement(a_myPluginHandle); });
+    }
+
+    TDM_API::APIResult TDMProxy::ReleaseDisableHeadtracking(TDM_API::PluginHandle a_myPluginHandle) noexcept {
+        return stats.Call(TDMMethod::kReleaseDisableHeadtracking, [&] { return m_inner->ReleaseDisableHeadtracking(a_myPluginHandle); });
+    }
+
+    TDMProxy::TDMProxy(TDM_API::IVTDM1* a_inner) :
+        stats("TDM", kTDMMethodNames), m_inner(a_inner) {
+        stats.SetOwnerThread(m_inner->GetTDMThreadId());
+    }
+
+    namespace APIProxies {
+        namespace {
+            bool s_isEnabled = false;
+            std::unique_ptr<FCFWProxy> s_fcfw;
+            std::unique_ptr<DTRProxy> s_dtr;
+            std::unique_ptr<TDMProxy> s_tdm;
+
+            template <class Proxy>
+            void LogActivation(const Proxy& a_proxy) {
+                if (!a_proxy) {
+                    return;
+                }
+                auto& stats = a_proxy->stats;
+                log::info("{}: {} calls, {:.3f} ms", stats.GetInterfaceName(), stats.GetActivationCalls(),
+                    stats.GetActivationNanoseconds() / 1000000.0);
+                stats.ResetActivation();
+            }
+        }
+
+        void SetEnabled(bool a_enabled) {
+            s_isEnabled = a_enabled;
+        }
+
+        bool IsEnabled() {
+            return s_isEnabled;
+        }
+
+        void Install() {
+            if (!s_isEnabled) {
+                return;
+            }
+
+            if (APIs::FCFW && !s_fcfw) {
+                s_fcfw = std::make_unique<FCFWProxy>(APIs::FCFW);
+                APIs::FCFW = s_fcfw.get();
+                log::info("{}: Proxying FCFW API", __FUNCTION__);
+            }
+            if (APIs::DTR && !s_dtr) {
+                s_dtr = std::make_unique<DTRProxy>(APIs::DTR);
+                APIs::DTR = s_dtr.get();
+                log::info("{}: Proxying DTR API", __FUNCTION__);
+            }
+            if (APIs::TrueDirectionalMovementV1 && !s_tdm) {
+                s_tdm = std::make_unique<TDMProxy>(APIs::TrueDirectionalMovementV1);
+                APIs::TrueDirectionalMovementV1 = s_tdm.get();
+                log::info("{}: Proxying TDM API", __FUNCTION__);
+            }
+        }
+
+        void EndActivation() {
+            if (!s_isEnabled) {
+                return;
+            }
+            LogActivation(s_fcfw);
+            LogActivation(s_dtr);
+            LogActivation(s_tdm);
+        }
+
+        bool Dump(const std::filesystem::path& a_path) {
+            std::ofstream file(a_path, std::ios::trunc);
+            if (!file) {
+                return false;
+            }
+
+            file << "Interface,Method,Calls,TotalUs,AverageUs,MaxUs,OffThreadCalls\n";
+            if (s_fcfw) {
+                s_fcfw->stats.Write(file);
+            }
+            if (s_dtr) {
+                s_dtr->stats.Write(file);
+            }
+            if (s_tdm) {
+                s_tdm->stats.Write(file);
+            }
+            // the cast queue is not a proxy, its rows are written either way
+            FreeCameraManager::GetSingleton().WriteCastQueueStats(file);
+            return file.good();
+        }
+    } // namespace APIProxies
+} // namespace SecondSight
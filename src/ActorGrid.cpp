@@ -0,0 +1,93 @@
+#include "ActorGrid.h"
+
+namespace SecondSight {
+    void ActorGrid::Sync() {
+        auto* processLists = RE::ProcessLists::GetSingleton();
+        if (!processLists) {
+            return;
+        }
+
+        m_grid.BeginSync();
+        for (auto& handle : processLists->highActorHandles) {
+            if (auto actor = handle.get()) {
+                Track(actor.get());
+            }
+        }
+        for (auto& handle : processLists->middleHighActorHandles) {
+            if (auto actor = handle.get()) {
+                Track(actor.get());
+            }
+        }
+
+        // drop actors which left the process lists since the last sync
+        for (auto formID : m_grid.EndSync()) {
+            m_handles.erase(formID);
+        }
+    }
+
+    void ActorGrid::Clear() {
+        m_grid.Clear();
+        m_handles.clear();
+    }
+
+    void ActorGrid::Track(RE::Actor* a_actor) {
+        auto formID = a_actor->GetFormID();
+        auto position = a_actor->GetPosition();
+        if (m_grid.Update(formID, { position.x, position.y, position.z })) {
+            m_handles[formID] = a_actor->GetHandle();
+        }
+    }
+
+    RE::Actor* ActorGrid::FindCrosshairTarget(const RE::NiPoint3& a_origin, const RE::NiPoint3& a_forward,
+        float a_maxDistance, float a_maxAngle, const RE::Actor* a_exclude, const ScreenProjection::Camera* a_camera) {
+
+        float maxDistance = a_maxDistance > 0.f ? a_maxDistance : kDefaultMaxDistance;
+        float cosMaxAngle = std::cos(std::clamp(a_maxAngle, 0.f, 180.f) * PI / 180.f);
+
+        // gather the candidates of the cells overlapping the cone in SoA layout
+        m_candidates.Clear();
+        m_candidateIDs.clear();
+        m_grid.ForEachNearCone({ a_origin.x, a_origin.y, a_origin.z }, { a_forward.x, a_forward.y, a_forward.z }, maxDistance, a_maxAngle,
+            [&](SpatialGrid::ID a_id, const SpatialGrid::Point& a_position) {
+                m_candidates.Add(a_position.x, a_position.y, a_position.z + kAnchorHeight);
+                m_candidateIDs.push_back(a_id);
+            });
+
+        // distance, cone and screen tests in one batch, before any handle is resolved
+        ScreenProjection::Query query;
+        query.camera = a_camera;
+        query.origin[0] = a_origin.x;
+        query.origin[1] = a_origin.y;
+        query.origin[2] = a_origin.z;
+        query.forward[0] = a_forward.x;
+        query.forward[1] = a_forward.y;
+        query.forward[2] = a_forward.z;
+        query.maxDistance = maxDistance;
+        query.cosMaxAngle = cosMaxAngle;
+        auto count = ScreenProjection::Project(query, m_candidates, m_projection);
+
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        RE::Actor* bestActor = nullptr;
+        float bestCos = cosMaxAngle;
+        float bestDistance = maxDistance;
+
+        for (size_t i = 0; i < count; ++i) {
+            float cosAngle = m_projection.cosAngle[i];
+            float distance = m_projection.distance[i];
+            if (cosAngle < bestCos || (cosAngle == bestCos && distance >= bestDistance)) {
+                continue;
+            }
+
+            auto actor = m_handles.at(m_candidateIDs[m_projection.indices[i]]).get();
+            if (!actor || actor.get() == player || actor.get() == a_exclude ||
+                actor->IsDead(true) || !actor->Get3D2()) {
+                continue;
+            }
+            bestActor = actor.get();
+            bestCos = cosAngle;
+            bestDistance = distance;
+        }
+
+        return bestActor;
+    }
+} // namespace SecondSight
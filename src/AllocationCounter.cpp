@@ -0,0 +1,87 @@
+#include "AllocationTracker.h"
+
+#include <cstdlib>
+#include <new>
+
+// The counting side of AllocationTracker, kept apart from the logging so the host allocation test in tools/
+// links the same operator new replacement.
+
+namespace {
+    thread_local std::uint64_t t_allocationCount = 0;
+}
+
+#ifdef SECONDSIGHT_TRACK_ALLOCATIONS
+namespace {
+    void* Allocate(std::size_t a_size) {
+        ++t_allocationCount;
+        return std::malloc(a_size ? a_size : 1);
+    }
+
+    void* AllocateAligned(std::size_t a_size, std::align_val_t a_alignment) {
+        ++t_allocationCount;
+        auto alignment = static_cast<std::size_t>(a_alignment);
+#if defined(_MSC_VER)
+        return _aligned_malloc(a_size ? a_size : 1, alignment);
+#else
+        // aligned_alloc wants a multiple of the alignment
+        return std::aligned_alloc(alignment, (a_size + alignment - 1) / alignment * alignment);
+#endif
+    }
+
+    void FreeAligned(void* a_ptr) {
+#if defined(_MSC_VER)
+        _aligned_free(a_ptr);
+#else
+        std::free(a_ptr);
+#endif
+    }
+}
+
+void* operator new(std::size_t a_size) {
+    if (auto* ptr = Allocate(a_size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_size) {
+    if (auto* ptr = Allocate(a_size)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new(std::size_t a_size, const std::nothrow_t&) noexcept { return Allocate(a_size); }
+void* operator new[](std::size_t a_size, const std::nothrow_t&) noexcept { return Allocate(a_size); }
+
+void* operator new(std::size_t a_size, std::align_val_t a_alignment) {
+    if (auto* ptr = AllocateAligned(a_size, a_alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void* operator new[](std::size_t a_size, std::align_val_t a_alignment) {
+    if (auto* ptr = AllocateAligned(a_size, a_alignment)) {
+        return ptr;
+    }
+    throw std::bad_alloc();
+}
+
+void operator delete(void* a_ptr) noexcept { std::free(a_ptr); }
+void operator delete[](void* a_ptr) noexcept { std::free(a_ptr); }
+void operator delete(void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
+void operator delete[](void* a_ptr, std::size_t) noexcept { std::free(a_ptr); }
+void operator delete(void* a_ptr, const std::nothrow_t&) noexcept { std::free(a_ptr); }
+void operator delete[](void* a_ptr, const std::nothrow_t&) noexcept { std::free(a_ptr); }
+void operator delete(void* a_ptr, std::align_val_t) noexcept { FreeAligned(a_ptr); }
+void operator delete[](void* a_ptr, std::align_val_t) noexcept { FreeAligned(a_ptr); }
+void operator delete(void* a_ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(a_ptr); }
+void operator delete[](void* a_ptr, std::size_t, std::align_val_t) noexcept { FreeAligned(a_ptr); }
+#endif
+
+namespace SecondSight {
+    std::uint64_t AllocationTracker::GetThreadCount() {
+        return t_allocationCount;
+    }
+} // namespace SecondSight
@@ -0,0 +1,39 @@
+#include "AllocationTracker.h"
+
+namespace SecondSight {
+    void AllocationTracker::Report(Scope a_scope, std::uint64_t a_count) {
+        if (a_scope == Scope::kActivation) {
+            if (a_count > kActivationBudget) {
+                log::error("{}: Activation made {} allocations, budget is {}", __FUNCTION__, a_count, kActivationBudget);
+            } else {
+                log::debug("{}: Activation made {} allocations", __FUNCTION__, a_count);
+            }
+            return;
+        }
+
+        ++m_frames;
+        if (a_count == 0) {
+            return;
+        }
+        if (m_allocatingFrames++ == 0) {
+            // only the first offending frame per activation, the summary follows in EndActivation
+            log::error("{}: Steady-state frame made {} allocations", __FUNCTION__, a_count);
+        }
+        m_frameAllocations += a_count;
+    }
+
+    void AllocationTracker::EndActivation() {
+        if constexpr (!kEnabled) {
+            return;
+        }
+
+        if (m_allocatingFrames > 0) {
+            log::error("{}: {} of {} frames allocated ({} allocations)", __FUNCTION__, m_allocatingFrames, m_frames, m_frameAllocations);
+        } else {
+            log::info("{}: {} frames, no allocations", __FUNCTION__, m_frames);
+        }
+        m_frames = 0;
+        m_allocatingFrames = 0;
+        m_frameAllocations = 0;
+    }
+} // namespace SecondSight
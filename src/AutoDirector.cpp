@@ -0,0 +1,169 @@
+#include "AutoDirector.h"
+#include "_ts_SKSEFunctions.h"
+#include "FreeCameraManager.h"
+#include "TraceRecorder.h"
+
+namespace SecondSight {
+    void AutoDirector::LoadSettings() {
+        const char* iniFile = "SKSE/Plugins/SecondSight.ini";
+
+        DirectorQueue::Settings settings;
+        settings.minDwell = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MinDwell:Director", iniFile, settings.minDwell);
+        settings.minDwell = std::max(settings.minDwell, 1.f);
+        settings.cooldown = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Cooldown:Director", iniFile, settings.cooldown);
+        settings.cooldown = std::max(settings.cooldown, 0.f);
+        settings.halfLife = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "ScoreHalfLife:Director", iniFile, settings.halfLife);
+        settings.halfLife = std::max(settings.halfLife, 0.5f);
+        m_queue = DirectorQueue(settings);
+
+        log::info("{}: Director dwell {:.1f} s, cooldown {:.1f} s, score half-life {:.1f} s", __FUNCTION__,
+            settings.minDwell, settings.cooldown, settings.halfLife);
+    }
+
+    void AutoDirector::RegisterEventSinks() {
+        auto* holder = RE::ScriptEventSourceHolder::GetSingleton();
+        if (!holder) {
+            log::error("{}: ScriptEventSourceHolder not available", __FUNCTION__);
+            return;
+        }
+        holder->AddEventSink<RE::TESCombatEvent>(this);
+        holder->AddEventSink<RE::TESHitEvent>(this);
+        holder->AddEventSink<RE::TESDeathEvent>(this);
+        holder->AddEventSink<RE::TESSpellCastEvent>(this);
+    }
+
+    void AutoDirector::SetEnabled(bool a_enabled) {
+        if (a_enabled == m_isEnabled) {
+            return;
+        }
+        m_isEnabled = a_enabled;
+
+        auto& manager = FreeCameraManager::GetSingleton();
+        if (!m_isEnabled && m_isDirecting && manager.GetEffectState() != SecondSight_API::EffectState::kInactive) {
+            manager.StopSecondSightEffect();
+        }
+
+        m_queue.Reset();
+        m_isDirecting = false;
+        m_current = 0;
+        m_time = 0.f;
+        m_lastCutTime = 0.f;
+        m_idleUntil = 0.f;
+        m_evaluateTimer = 0.f;
+
+        log::info("{}: Auto-director {}", __FUNCTION__, m_isEnabled ? "enabled" : "disabled");
+    }
+
+    void AutoDirector::Update(float a_delta) {
+        if (!m_isEnabled) {
+            return;
+        }
+
+        m_time += a_delta;
+        m_evaluateTimer += a_delta;
+        if (m_evaluateTimer < kEvaluateInterval) {
+            return;
+        }
+        m_evaluateTimer = 0.f;
+
+        Cut();
+    }
+
+    void AutoDirector::Cut() {
+        auto& manager = FreeCameraManager::GetSingleton();
+        auto state = manager.GetEffectState();
+
+        if (state == SecondSight_API::EffectState::kInactive) {
+            if (m_isDirecting) {
+                // our effect ended (stopped or target lost), give the camera a moment before the next one
+                m_isDirecting = false;
+                m_current = 0;
+                m_idleUntil = m_time + kRestartDelay;
+            }
+            if (m_time < m_idleUntil) {
+                return;
+            }
+        } else if (!m_isDirecting || state != SecondSight_API::EffectState::kAtTarget) {
+            // the effect was started by someone else, or the camera is moving
+            return;
+        }
+
+        auto current = state == SecondSight_API::EffectState::kInactive ? 0 : m_current;
+        auto pick = m_queue.SelectCut(current, m_lastCutTime, m_time);
+        if (!pick) {
+            return;
+        }
+
+        auto* actor = RE::TESForm::LookupByID<RE::Actor>(*pick);
+        if (!actor || !actor->Is3DLoaded() || actor->IsDead()) {
+            m_queue.Remove(*pick);
+            return;
+        }
+
+        manager.SetExplicitTarget(actor);
+        bool success = state == SecondSight_API::EffectState::kInactive ? manager.StartSecondSightEffect(CastQueue::Source::kDirector) : manager.HopToNextTarget();
+        manager.SetExplicitTarget(nullptr);
+
+        TraceRecorder::GetSingleton().Instant(success ? "Director::Cut" : "Director::CutFailed", *pick);
+        if (!success) {
+            // not reachable right now (too far, no anchor point), try the others first
+            m_queue.SetCooldown(*pick, m_time);
+            return;
+        }
+
+        log::info("{}: Cut from {:08X} to {:08X} ({:.2f})", __FUNCTION__, m_current, *pick, m_queue.GetScore(*pick, m_time));
+        m_queue.OnCut(current, *pick, m_time);
+        m_isDirecting = true;
+        m_current = *pick;
+        m_lastCutTime = m_time;
+    }
+
+    void AutoDirector::AddEvent(RE::TESObjectREFR* a_ref, DirectorQueue::EventType a_type) {
+        auto* actor = a_ref ? a_ref->As<RE::Actor>() : nullptr;
+        if (!actor || actor->IsPlayerRef() || actor->IsDead()) {
+            return;
+        }
+
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        if (!player || actor->GetPosition().GetSquaredDistance(player->GetPosition()) > kMaxEventDistance * kMaxEventDistance) {
+            return;
+        }
+
+        m_queue.AddScore(actor->GetFormID(), DirectorQueue::GetEventWeight(a_type), m_time);
+    }
+
+    RE::BSEventNotifyControl AutoDirector::ProcessEvent(const RE::TESCombatEvent* a_event, RE::BSTEventSource<RE::TESCombatEvent>*) {
+        if (m_isEnabled && a_event && a_event->newState.get() == RE::ACTOR_COMBAT_STATE::kCombat) {
+            AddEvent(a_event->actor.get(), DirectorQueue::EventType::kCombatStart);
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    RE::BSEventNotifyControl AutoDirector::ProcessEvent(const RE::TESHitEvent* a_event, RE::BSTEventSource<RE::TESHitEvent>*) {
+        if (m_isEnabled && a_event) {
+            AddEvent(a_event->cause.get(), DirectorQueue::EventType::kHit);
+            AddEvent(a_event->target.get(), DirectorQueue::EventType::kHit);
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    RE::BSEventNotifyControl AutoDirector::ProcessEvent(const RE::TESDeathEvent* a_event, RE::BSTEventSource<RE::TESDeathEvent>*) {
+        if (m_isEnabled && a_event) {
+            if (a_event->actorDying) {
+                m_queue.Remove(a_event->actorDying->GetFormID());
+            }
+            if (!a_event->dead) {
+                // sent once when the actor starts dying and once when it is dead, only count the kill once
+                AddEvent(a_event->actorKiller.get(), DirectorQueue::EventType::kDeath);
+            }
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+
+    RE::BSEventNotifyControl AutoDirector::ProcessEvent(const RE::TESSpellCastEvent* a_event, RE::BSTEventSource<RE::TESSpellCastEvent>*) {
+        if (m_isEnabled && a_event) {
+            AddEvent(a_event->object.get(), DirectorQueue::EventType::kSpellCast);
+        }
+        return RE::BSEventNotifyControl::kContinue;
+    }
+} // namespace SecondSight
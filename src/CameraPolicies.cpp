@@ -0,0 +1,80 @@
+#include "CameraPolicies.h"
+#include "APIManager.h"
+#include "FreeCameraManager.h"
+#include "Offsets.h"
+
+namespace SecondSight::Policies {
+    bool ExplicitTargetSource::Select(const TargetQuery& a_query, RE::Actor*& a_out) {
+        auto explicitTarget = a_query.explicitTarget.get();
+        if (!explicitTarget) {
+            return false;
+        }
+        a_out = explicitTarget.get();
+        return true;
+    }
+
+    bool DTRTargetSource::Select(const TargetQuery&, RE::Actor*& a_out) {
+        if (!APIs::DTR || !APIs::DTR->IsReticleActive()) {
+            return false;
+        }
+        a_out = APIs::DTR->GetCurrentTarget();
+        return true;
+    }
+
+    bool TDMTargetSource::Select(const TargetQuery&, RE::Actor*& a_out) {
+        if (!APIs::TrueDirectionalMovementV1 || !APIs::TrueDirectionalMovementV1->GetTargetLockState()) {
+            return false;
+        }
+        auto targetHandle = APIs::TrueDirectionalMovementV1->GetCurrentTarget();
+        if (targetHandle) {
+            a_out = targetHandle.get().get();
+        }
+        return true;
+    }
+
+    bool CrosshairTargetSource::Select(const TargetQuery& a_query, RE::Actor*& a_out) {
+        a_out = FreeCameraManager::GetSingleton().GetCrosshairTarget(a_query.crosshairDistance, a_query.crosshairAngle, a_query.exclude);
+        return true;
+    }
+
+    template <RE::BGSBodyPartDefs::LIMB_ENUM Part>
+    RE::NiPointer<RE::NiAVObject> BodyPartAnchor<Part>::Get(RE::Actor* a_actor) {
+        if (!a_actor) {
+            return nullptr;
+        }
+
+        auto race = a_actor->GetRace();
+        if (!race) {
+            return nullptr;
+        }
+
+        RE::BGSBodyPartData* bodyPartData = race->bodyPartData;
+        if (!bodyPartData) {
+            return nullptr;
+        }
+
+        auto actor3D = a_actor->Get3D2();
+        if (!actor3D) {
+            return nullptr;
+        }
+
+        RE::BGSBodyPart* bodyPart = bodyPartData->parts[Part];
+        if (!bodyPart) {
+            bodyPart = bodyPartData->parts[RE::BGSBodyPartDefs::LIMB_ENUM::kTotal];
+        }
+        if (!bodyPart) {
+            return nullptr;
+        }
+        return RE::NiPointer<RE::NiAVObject>(NiAVObject_LookupBoneNodeByName(actor3D, bodyPart->targetName, true));
+    }
+
+    template struct BodyPartAnchor<RE::BGSBodyPartDefs::LIMB_ENUM::kHead>;
+    template struct BodyPartAnchor<RE::BGSBodyPartDefs::LIMB_ENUM::kTorso>;
+
+    RE::NiPointer<RE::NiAVObject> RootAnchor::Get(RE::Actor* a_actor) {
+        if (!a_actor) {
+            return nullptr;
+        }
+        return RE::NiPointer<RE::NiAVObject>(a_actor->Get3D2());
+    }
+} // namespace SecondSight::Policies
@@ -0,0 +1,249 @@
+#include "CameraPresets.h"
+
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+
+#include <rapidcsv.h>
+
+namespace SecondSight {
+    namespace {
+        constexpr auto kPresetFile = "Data/SKSE/Plugins/SecondSight_Presets.csv";
+        constexpr auto kCacheFile = "Data/SKSE/Plugins/SecondSight_Presets.bin";
+
+        using Leg = CameraPresets::Leg;
+        using Channel = CameraPresets::Channel;
+        using Anchor = CameraPresets::Anchor;
+
+        template <class E, size_t N>
+        bool ParseEnum(const std::string& a_value, const std::array<std::pair<std::string_view, E>, N>& a_names, E& a_out) {
+            for (auto& [name, value] : a_names) {
+                if (_stricmp(a_value.c_str(), name.data()) == 0) {
+                    a_out = value;
+                    return true;
+                }
+            }
+            return false;
+        }
+
+        constexpr std::array<std::pair<std::string_view, Leg>, 3> kLegNames{ {
+            { "TransitionToTarget", Leg::kTransitionToTarget },
+            { "AtTarget", Leg::kAtTarget },
+            { "TransitionToPrevious", Leg::kTransitionToPrevious },
+        } };
+
+        constexpr std::array<std::pair<std::string_view, Channel>, 2> kChannelNames{ {
+            { "Translation", Channel::kTranslation },
+            { "Rotation", Channel::kRotation },
+        } };
+
+        constexpr std::array<std::pair<std::string_view, Anchor>, 4> kAnchorNames{ {
+            { "Camera", Anchor::kCamera },
+            { "Target", Anchor::kTarget },
+            { "TargetLookAt", Anchor::kTargetLookAt },
+            { "Return", Anchor::kReturn },
+        } };
+    }
+
+    void CameraPresets::Load() {
+        std::ifstream file(kPresetFile, std::ios::binary);
+        if (!file) {
+            log::info("{}: {} not found, using built-in camera presets", __FUNCTION__, kPresetFile);
+            LoadDefaults();
+            return;
+        }
+        std::string content((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+
+        auto contentHash = HashContent(content);
+        if (LoadCache(contentHash)) {
+            log::info("{}: Loaded {} camera preset keyframes from cache", __FUNCTION__, m_keyframes.size());
+            return;
+        }
+
+        std::vector<Keyframe> keyframes;
+        if (!Parse(content, keyframes) || !Validate(keyframes)) {
+            log::error("{}: Invalid camera presets in {}, using built-in camera presets", __FUNCTION__, kPresetFile);
+            LoadDefaults();
+            return;
+        }
+
+        SetKeyframes(std::move(keyframes));
+        WriteCache(contentHash);
+        log::info("{}: Compiled {} camera preset keyframes from {}", __FUNCTION__, m_keyframes.size(), kPresetFile);
+    }
+
+    std::span<const CameraPresets::Keyframe> CameraPresets::GetLeg(Leg a_leg) const {
+        auto index = static_cast<size_t>(a_leg);
+        if (index >= static_cast<size_t>(Leg::kTotal)) {
+            return {};
+        }
+        return std::span<const Keyframe>(m_keyframes).subspan(m_legOffsets[index], m_legOffsets[index + 1] - m_legOffsets[index]);
+    }
+
+    std::uint64_t CameraPresets::HashContent(std::string_view a_content) {
+        // FNV-1a
+        std::uint64_t hash = 14695981039346656037ull;
+        for (unsigned char c : a_content) {
+            hash ^= c;
+            hash *= 1099511628211ull;
+        }
+        return hash;
+    }
+
+    bool CameraPresets::LoadCache(std::uint64_t a_contentHash) {
+        std::ifstream file(kCacheFile, std::ios::binary);
+        if (!file) {
+            return false;
+        }
+
+        std::error_code error;
+        auto fileSize = std::filesystem::file_size(kCacheFile, error);
+        if (error || fileSize < sizeof(CacheHeader)) {
+            return false;
+        }
+
+        CacheHeader header;
+        if (!file.read(reinterpret_cast<char*>(&header), sizeof(header)) ||
+            header.magic != kCacheMagic || header.version != kCacheVersion ||
+            header.contentHash != a_contentHash || header.keyframeCount == 0) {
+            return false;
+        }
+        // the count is checked against the file before anything is allocated for it
+        if (header.keyframeCount != (fileSize - sizeof(CacheHeader)) / sizeof(Keyframe)) {
+            return false;
+        }
+
+        std::vector<Keyframe> keyframes(header.keyframeCount);
+        if (!file.read(reinterpret_cast<char*>(keyframes.data()), keyframes.size() * sizeof(Keyframe))) {
+            return false;
+        }
+
+        // the cache was validated when it was written, only guard against a corrupted file
+        if (!Validate(keyframes)) {
+            return false;
+        }
+
+        SetKeyframes(std::move(keyframes));
+        return true;
+    }
+
+    void CameraPresets::WriteCache(std::uint64_t a_contentHash) const {
+        std::ofstream file(kCacheFile, std::ios::binary | std::ios::trunc);
+        if (!file) {
+            log::warn("{}: Could not write {}", __FUNCTION__, kCacheFile);
+            return;
+        }
+
+        CacheHeader header;
+        header.contentHash = a_contentHash;
+        header.keyframeCount = static_cast<std::uint32_t>(m_keyframes.size());
+        file.write(reinterpret_cast<const char*>(&header), sizeof(header));
+        file.write(reinterpret_cast<const char*>(m_keyframes.data()), m_keyframes.size() * sizeof(Keyframe));
+    }
+
+    bool CameraPresets::Parse(const std::string& a_content, std::vector<Keyframe>& a_keyframes) const {
+        try {
+            std::istringstream stream(a_content);
+            rapidcsv::Document doc(stream, rapidcsv::LabelParams(0, -1), rapidcsv::SeparatorParams(),
+                rapidcsv::ConverterParams(), rapidcsv::LineReaderParams(true, '#', true));
+
+            auto legs = doc.GetColumn<std::string>("Leg");
+            auto channels = doc.GetColumn<std::string>("Channel");
+            auto anchors = doc.GetColumn<std::string>("Anchor");
+            auto times = doc.GetColumn<float>("Time");
+            auto easeIns = doc.GetColumn<int>("EaseIn");
+            auto easeOuts = doc.GetColumn<int>("EaseOut");
+
+            a_keyframes.clear();
+            a_keyframes.reserve(legs.size());
+            for (size_t row = 0; row < legs.size(); ++row) {
+                Keyframe keyframe;
+                if (!ParseEnum(legs[row], kLegNames, keyframe.leg) ||
+                    !ParseEnum(channels[row], kChannelNames, keyframe.channel) ||
+                    !ParseEnum(anchors[row], kAnchorNames, keyframe.anchor)) {
+                    log::error("{}: Unknown leg, channel or anchor in row {}", __FUNCTION__, row + 1);
+                    return false;
+                }
+                keyframe.time = times[row];
+                keyframe.easeIn = easeIns[row] != 0;
+                keyframe.easeOut = easeOuts[row] != 0;
+                a_keyframes.push_back(keyframe);
+            }
+        } catch (const std::exception& e) {
+            log::error("{}: {}", __FUNCTION__, e.what());
+            return false;
+        }
+
+        return true;
+    }
+
+    bool CameraPresets::Validate(const std::vector<Keyframe>& a_keyframes) const {
+        std::array<std::array<bool, 2>, static_cast<size_t>(Leg::kTotal)> hasChannel{};
+
+        for (auto& keyframe : a_keyframes) {
+            auto leg = static_cast<size_t>(keyframe.leg);
+            auto channel = static_cast<size_t>(keyframe.channel);
+            if (leg >= hasChannel.size() || channel > 1 || keyframe.anchor > Anchor::kReturn || keyframe.easeIn > 1 || keyframe.easeOut > 1) {
+                return false;
+            }
+            if (!(keyframe.time >= 0.f && keyframe.time <= 1.f)) {
+                log::error("{}: Keyframe time {} is outside of [0, 1]", __FUNCTION__, keyframe.time);
+                return false;
+            }
+            if (keyframe.anchor == Anchor::kTargetLookAt && keyframe.channel != Channel::kRotation) {
+                log::error("{}: TargetLookAt is only valid for rotation keyframes", __FUNCTION__);
+                return false;
+            }
+            if (keyframe.anchor == Anchor::kReturn && keyframe.leg != Leg::kTransitionToPrevious) {
+                log::error("{}: Return anchors are only valid in the TransitionToPrevious leg", __FUNCTION__);
+                return false;
+            }
+            hasChannel[leg][channel] = true;
+        }
+
+        for (auto& channels : hasChannel) {
+            if (!channels[0] || !channels[1]) {
+                log::error("{}: Every leg needs at least one translation and one rotation keyframe", __FUNCTION__);
+                return false;
+            }
+        }
+
+        return true;
+    }
+
+    void CameraPresets::SetKeyframes(std::vector<Keyframe> a_keyframes) {
+        std::stable_sort(a_keyframes.begin(), a_keyframes.end(), [](const Keyframe& a_lhs, const Keyframe& a_rhs) {
+            return a_lhs.leg != a_rhs.leg ? a_lhs.leg < a_rhs.leg : a_lhs.time < a_rhs.time;
+        });
+        m_keyframes = std::move(a_keyframes);
+
+        m_legOffsets.fill(m_keyframes.size());
+        for (size_t leg = 0, i = 0; leg <= static_cast<size_t>(Leg::kTotal); ++leg) {
+            while (i < m_keyframes.size() && static_cast<size_t>(m_keyframes[i].leg) < leg) {
+                ++i;
+            }
+            m_legOffsets[leg] = i;
+        }
+    }
+
+    void CameraPresets::LoadDefaults() {
+        SetKeyframes({
+            // time, leg, channel, anchor, easeIn, easeOut
+            { 0.0f, Leg::kTransitionToTarget, Channel::kTranslation, Anchor::kCamera, 1, 1 },
+            { 0.0f, Leg::kTransitionToTarget, Channel::kRotation, Anchor::kCamera, 1, 1 },
+            { 0.2f, Leg::kTransitionToTarget, Channel::kRotation, Anchor::kTargetLookAt, 1, 1 },  // finished rotating towards the movement direction
+            { 0.5f, Leg::kTransitionToTarget, Channel::kRotation, Anchor::kTargetLookAt, 1, 1 },  // start rotating towards the target
+            { 1.0f, Leg::kTransitionToTarget, Channel::kTranslation, Anchor::kTarget, 1, 1 },
+            { 1.0f, Leg::kTransitionToTarget, Channel::kRotation, Anchor::kTarget, 1, 1 },
+
+            { 0.0f, Leg::kAtTarget, Channel::kTranslation, Anchor::kTarget, 1, 1 },
+            { 0.0f, Leg::kAtTarget, Channel::kRotation, Anchor::kTarget, 1, 1 },
+
+            { 0.0f, Leg::kTransitionToPrevious, Channel::kTranslation, Anchor::kCamera, 1, 1 },
+            { 0.0f, Leg::kTransitionToPrevious, Channel::kRotation, Anchor::kCamera, 1, 1 },
+            { 0.5f, Leg::kTransitionToPrevious, Channel::kRotation, Anchor::kTargetLookAt, 1, 1 },
+            { 1.0f, Leg::kTransitionToPrevious, Channel::kTranslation, Anchor::kReturn, 1, 1 },
+            { 1.0f, Leg::kTransitionToPrevious, Channel::kRotation, Anchor::kReturn, 1, 1 },
+        });
+    }
+} // namespace SecondSight
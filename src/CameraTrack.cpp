@@ -0,0 +1,105 @@
+#include "CameraTrack.h"
+
+namespace SecondSight {
+    using CameraMath::Vec3;
+
+    size_t CameraTrack::Add(const Key& a_key) {
+        auto it = std::upper_bound(m_keys.begin(), m_keys.end(), a_key.time, [](float a_time, const Key& a_rhs) {
+            return a_time < a_rhs.time;
+        });
+        it = m_keys.insert(it, a_key);
+        return static_cast<size_t>(it - m_keys.begin());
+    }
+
+    bool CameraTrack::Remove(size_t a_index) {
+        if (a_index >= m_keys.size()) {
+            return false;
+        }
+        m_keys.erase(m_keys.begin() + a_index);
+        return true;
+    }
+
+    float CameraTrack::Ease(float a_t, bool a_easeIn, bool a_easeOut) {
+        a_t = std::clamp(a_t, 0.f, 1.f);
+        if (a_easeIn && a_easeOut) {
+            return a_t * a_t * (3.f - 2.f * a_t);
+        } else if (a_easeIn) {
+            return a_t * a_t;
+        } else if (a_easeOut) {
+            return a_t * (2.f - a_t);
+        }
+        return a_t;
+    }
+
+    Vec3 CameraTrack::GetUnwrapped(size_t a_index, const Vec3& a_reference) const {
+        auto& value = m_keys[a_index].value;
+        if (!m_isRotation) {
+            return value;
+        }
+        float yaw = a_reference.Y() + CameraMath::NormalizeAngle(value.Y() - a_reference.Y());
+        return Vec3(value.X(), yaw, 0.f);
+    }
+
+    Vec3 CameraTrack::Evaluate(float a_time) const {
+        if (m_keys.empty()) {
+            return Vec3();
+        }
+        if (a_time <= m_keys.front().time) {
+            return m_keys.front().value;
+        }
+        if (a_time >= m_keys.back().time) {
+            return m_keys.back().value;
+        }
+
+        // segment [i, i + 1] containing a_time
+        auto next = std::upper_bound(m_keys.begin(), m_keys.end(), a_time, [](float a_t, const Key& a_rhs) {
+            return a_t < a_rhs.time;
+        });
+        size_t i1 = static_cast<size_t>(next - m_keys.begin());
+        size_t i0 = i1 - 1;
+        auto& k0 = m_keys[i0];
+        auto& k1 = m_keys[i1];
+
+        float span = k1.time - k0.time;
+        if (span <= 0.f || k1.interpolation == Interpolation::kNone) {
+            return k0.value;
+        }
+        float t = Ease((a_time - k0.time) / span, k1.easeIn, k1.easeOut);
+
+        Vec3 p0 = k0.value;
+        Vec3 p1 = GetUnwrapped(i1, p0);
+        Vec3 result;
+        if (k1.interpolation == Interpolation::kLinear) {
+            result = CameraMath::Lerp(p0, p1, t);
+        } else {
+            // Catmull-Rom tangents scaled to the segment, one-sided at the ends of the track
+            Vec3 m0 = p1 - p0;
+            if (i0 > 0) {
+                auto& kPrev = m_keys[i0 - 1];
+                Vec3 pPrev = GetUnwrapped(i0 - 1, p0);
+                float dt = k1.time - kPrev.time;
+                if (dt > 0.f) {
+                    m0 = (p1 - pPrev) * (span / dt);
+                }
+            }
+            Vec3 m1 = p1 - p0;
+            if (i1 + 1 < m_keys.size()) {
+                auto& kNext = m_keys[i1 + 1];
+                Vec3 pNext = GetUnwrapped(i1 + 1, p1);
+                float dt = kNext.time - k0.time;
+                if (dt > 0.f) {
+                    m1 = (pNext - p0) * (span / dt);
+                }
+            }
+
+            float t2 = t * t;
+            float t3 = t2 * t;
+            result = p0 * (2.f * t3 - 3.f * t2 + 1.f) + m0 * (t3 - 2.f * t2 + t) + p1 * (-2.f * t3 + 3.f * t2) + m1 * (t3 - t2);
+        }
+
+        if (m_isRotation) {
+            result = Vec3(result.X(), CameraMath::NormalizeAngle(result.Y()), 0.f);
+        }
+        return result;
+    }
+} // namespace SecondSight
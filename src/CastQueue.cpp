@@ -0,0 +1,49 @@
+#include "CastQueue.h"
+
+#include <algorithm>
+
+namespace SecondSight {
+    void CastQueue::Push(Clock::duration a_timeToLive, Clock::time_point a_now) {
+        DropExpired(a_now);
+
+        if (m_request) {
+            m_request->expires = a_now + a_timeToLive;
+            ++m_stats.replaced;
+            return;
+        }
+        m_request = Request{ a_now, a_now + a_timeToLive };
+    }
+
+    std::optional<CastQueue::Request> CastQueue::Pop(Clock::time_point a_now) {
+        DropExpired(a_now);
+        auto request = m_request;
+        m_request.reset();
+        return request;
+    }
+
+    void CastQueue::RecordServed(const Request& a_request, Clock::time_point a_now) {
+        auto wait = a_now - a_request.enqueued;
+        ++m_stats.served;
+        m_stats.totalWait += wait;
+        m_stats.maxWait = std::max(m_stats.maxWait, wait);
+    }
+
+    void CastQueue::DropExpired(Clock::time_point a_now) {
+        if (m_request && m_request->expires <= a_now) {
+            m_request.reset();
+            ++m_stats.expired;
+        }
+    }
+
+    void CastQueue::WriteStats(std::ostream& a_stream) const {
+        using Microseconds = std::chrono::duration<double, std::micro>;
+
+        auto total = Microseconds(m_stats.totalWait).count();
+        a_stream << "CastQueue,Wait," << m_stats.served << ',' << total << ','
+                 << (m_stats.served > 0 ? total / m_stats.served : 0.0) << ','
+                 << Microseconds(m_stats.maxWait).count() << ",0\n";
+        a_stream << "CastQueue,Failed," << m_stats.failed << ",0,0,0,0\n";
+        a_stream << "CastQueue,Expired," << m_stats.expired << ",0,0,0,0\n";
+        a_stream << "CastQueue,Replaced," << m_stats.replaced << ",0,0,0,0\n";
+    }
+} // namespace SecondSight
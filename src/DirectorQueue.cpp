@@ -0,0 +1,156 @@
+#include "DirectorQueue.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SecondSight {
+    void DirectorQueue::Reset() {
+        m_candidates.clear();
+        m_heap.clear();
+        m_epoch = 0.f;
+    }
+
+    float DirectorQueue::GetEventWeight(EventType a_type) {
+        switch (a_type) {
+        case EventType::kCombatStart:
+            return 3.f;
+        case EventType::kHit:
+            return 1.f;
+        case EventType::kDeath:
+            return 5.f;
+        case EventType::kSpellCast:
+            return 1.5f;
+        }
+        return 0.f;
+    }
+
+    void DirectorQueue::AddScore(CandidateID a_id, float a_weight, float a_time) {
+        if (a_id == 0) {
+            return;
+        }
+        if (static_cast<double>(a_time - m_epoch) / (m_settings.halfLife / std::log(2.0)) > kMaxExponent) {
+            Rebase(a_time);
+        }
+
+        auto& candidate = m_candidates[a_id];
+        candidate.key += ToKey(a_weight, a_time);
+        candidate.version = ++m_version;
+        m_heap.push_back({ candidate.key, a_id, candidate.version });
+        std::push_heap(m_heap.begin(), m_heap.end());
+
+        if (m_heap.size() > kCompactRatio * m_candidates.size()) {
+            Compact();
+        }
+    }
+
+    void DirectorQueue::Remove(CandidateID a_id) {
+        // heap entries of the candidate become stale and are dropped lazily
+        m_candidates.erase(a_id);
+    }
+
+    float DirectorQueue::GetScore(CandidateID a_id, float a_time) const {
+        auto it = m_candidates.find(a_id);
+        return it != m_candidates.end() ? FromKey(it->second.key, a_time) : 0.f;
+    }
+
+    std::optional<DirectorQueue::CandidateID> DirectorQueue::SelectCut(CandidateID a_current, float a_lastCutTime, float a_time) {
+        bool hasCurrent = a_current != 0 && m_candidates.contains(a_current);
+        if (hasCurrent && a_time - a_lastCutTime < m_settings.minDwell) {
+            return std::nullopt;
+        }
+
+        std::optional<CandidateID> result;
+        m_deferred.clear();
+        while (!m_heap.empty()) {
+            auto entry = m_heap.front();
+            if (!IsCurrent(entry)) {
+                std::pop_heap(m_heap.begin(), m_heap.end());
+                m_heap.pop_back();
+                continue;
+            }
+
+            float score = FromKey(entry.key, a_time);
+            if (score < m_settings.minScore) {
+                // the best remaining candidate has faded, so have all others
+                break;
+            }
+
+            auto& candidate = m_candidates[entry.id];
+            if (entry.id == a_current || candidate.cooldownUntil > a_time) {
+                // keep it for later, look at the next best
+                std::pop_heap(m_heap.begin(), m_heap.end());
+                m_heap.pop_back();
+                m_deferred.push_back(entry);
+                continue;
+            }
+
+            if (!hasCurrent || score > GetScore(a_current, a_time) * m_settings.switchRatio) {
+                result = entry.id;
+            }
+            break;
+        }
+
+        for (auto& entry : m_deferred) {
+            m_heap.push_back(entry);
+            std::push_heap(m_heap.begin(), m_heap.end());
+        }
+
+        return result;
+    }
+
+    void DirectorQueue::OnCut(CandidateID a_from, CandidateID a_to, float a_time) {
+        SetCooldown(a_from, a_time);
+        if (auto it = m_candidates.find(a_to); it != m_candidates.end()) {
+            it->second.cooldownUntil = -1.f;
+        }
+    }
+
+    void DirectorQueue::SetCooldown(CandidateID a_id, float a_time) {
+        if (auto it = m_candidates.find(a_id); it != m_candidates.end()) {
+            it->second.cooldownUntil = a_time + m_settings.cooldown;
+        }
+    }
+
+    double DirectorQueue::ToKey(float a_score, float a_time) const {
+        double tau = m_settings.halfLife / std::log(2.0);
+        return a_score * std::exp((a_time - m_epoch) / tau);
+    }
+
+    float DirectorQueue::FromKey(double a_key, float a_time) const {
+        double tau = m_settings.halfLife / std::log(2.0);
+        return static_cast<float>(a_key * std::exp(-(a_time - m_epoch) / tau));
+    }
+
+    void DirectorQueue::Rebase(float a_time) {
+        // move the epoch to now; scales all keys equally, so the order is unchanged
+        double scale = std::exp(-(a_time - m_epoch) / (m_settings.halfLife / std::log(2.0)));
+        m_epoch = a_time;
+
+        for (auto it = m_candidates.begin(); it != m_candidates.end();) {
+            it->second.key *= scale;
+            if (it->second.key < m_settings.minScore * 1e-3) {
+                it = m_candidates.erase(it);
+            } else {
+                ++it;
+            }
+        }
+
+        m_heap.clear();
+        for (auto& [id, candidate] : m_candidates) {
+            candidate.version = ++m_version;
+            m_heap.push_back({ candidate.key, id, candidate.version });
+        }
+        std::make_heap(m_heap.begin(), m_heap.end());
+    }
+
+    void DirectorQueue::Compact() {
+        // every candidate has exactly one current entry, the rest are outdated; in place, no reallocation
+        std::erase_if(m_heap, [this](const HeapEntry& a_entry) { return !IsCurrent(a_entry); });
+        std::make_heap(m_heap.begin(), m_heap.end());
+    }
+
+    bool DirectorQueue::IsCurrent(const HeapEntry& a_entry) const {
+        auto it = m_candidates.find(a_entry.id);
+        return it != m_candidates.end() && it->second.version == a_entry.version;
+    }
+} // namespace SecondSight
@@ -1,11 +1,21 @@
 #include "FreeCameraManager.h"
 #include "_ts_SKSEFunctions.h"
 #include "APIManager.h"
+#include "ActorGrid.h"
+#include "TraceRecorder.h"
+#include "CameraMath.h"
+#include "QualityGovernor.h"
+#include "AllocationTracker.h"
+#include "APIProxies.h"
 #include "Offsets.h"
+#include "RewindRecorder.h"
+#include "NativeCameraDriver.h"
 
 namespace SecondSight {
     void FreeCameraManager::Initialize()
     {
+        LoadSettings();
+
         if (!APIs::FCFW) {
             log::error("{}: FCFW API not available, SecondSight will not function properly!", __FUNCTION__);
             RE::DebugMessageBox("SecondSight: FreeCamera Framework (FCFW) not available, SecondSight will not function properly!");
@@ -25,6 +35,7 @@ namespace SecondSight {
         m_transitionToTarget_TimelineID = 0;
         m_atTarget_TimelineID = 0;
         m_transitionToPrevious_TimelineID = 0;
+        m_castQueue.Clear();
 
         // Register listener for FCFW timeline events
         if (!SKSE::GetMessagingInterface()->RegisterListener(FCFW_API::FCFWPluginName, SecondSight::FreeCameraManager::FCFWMessageHandler)) {
@@ -40,6 +51,39 @@ namespace SecondSight {
         }
     }
 
+    void FreeCameraManager::LoadSettings()
+    {
+        const char* iniFile = "SKSE/Plugins/SecondSight.ini";
+
+        m_targetGracePeriod = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "TargetReacquireGracePeriod:Settings", iniFile, 1.5f);
+        m_targetGracePeriod = std::max(m_targetGracePeriod, 0.f);
+
+        long enableLongRange = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "EnableLongRange:LongRange", iniFile, 1L);
+        m_isLongRangeEnabled = enableLongRange != 0;
+        m_longRangeMaxDistance = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MaxDistance:LongRange", iniFile, 30000.f);
+        m_longRangeMaxDistance = std::max(m_longRangeMaxDistance, kMaxTargetDistance);
+        m_longRangeSpeed = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Speed:LongRange", iniFile, 8000.f);
+        m_longRangeSpeed = std::max(m_longRangeSpeed, 100.f);
+        m_longRangeSettings.stageLength = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "StageLength:LongRange", iniFile, 6000.f);
+        m_longRangeSettings.stageLength = std::max(m_longRangeSettings.stageLength, 1000.f);
+
+        // the defaults were tuned by hand, tools/autotune searches them offline
+        m_transitionTiming.minDistance = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MinDistance:Transition", iniFile, 2000.f);
+        m_transitionTiming.minDistance = std::max(m_transitionTiming.minDistance, 0.f);
+        m_transitionTiming.maxDistance = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MaxDistance:Transition", iniFile, 10000.f);
+        m_transitionTiming.maxDistance = std::max(m_transitionTiming.maxDistance, m_transitionTiming.minDistance + 100.f);
+        m_transitionTiming.minTime = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MinTime:Transition", iniFile, 0.5f);
+        m_transitionTiming.minTime = std::max(m_transitionTiming.minTime, 0.1f);
+        m_transitionTiming.maxTime = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MaxTime:Transition", iniFile, 2.0f);
+        m_transitionTiming.maxTime = std::max(m_transitionTiming.maxTime, m_transitionTiming.minTime);
+
+        m_eyesStabilization = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "EyesStabilization:Settings", iniFile, 0.f);
+        m_eyesStabilization = std::max(m_eyesStabilization, 0.f);
+
+        m_castQueueTimeout = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "CastQueueTimeout:Settings", iniFile, 10.f);
+        m_castQueueTimeout = std::max(m_castQueueTimeout, 0.f);
+    }
+
     void FreeCameraManager::FCFWMessageHandler(SKSE::MessagingInterface::Message* a_msg)
     {
         if (!APIs::FCFW) {
@@ -51,26 +95,41 @@ namespace SecondSight {
         }
         
         auto& self = GetSingleton();
+        auto* eventData = static_cast<FCFW_API::FCFWTimelineEventData*>(a_msg->data);
+        auto& trace = TraceRecorder::GetSingleton();
 
         switch (static_cast<FCFW_API::FCFWMessage>(a_msg->type)) {
         case FCFW_API::FCFWMessage::kPlaybackStart:
+            trace.Instant("FCFW::kPlaybackStart", eventData ? eventData->timelineID : 0);
             if (APIs::DTR) {
                 APIs::DTR->ShowReticle(false);
             }
             break;
         case FCFW_API::FCFWMessage::kPlaybackStop:
+            trace.Instant("FCFW::kPlaybackStop", eventData ? eventData->timelineID : 0);
             if (APIs::DTR) {
                 APIs::DTR->ShowReticle(true);
             }
+            if (eventData && eventData->timelineID != 0 &&
+                (eventData->timelineID == self.m_transitionToTarget_TimelineID ||
+                 eventData->timelineID == self.m_atTarget_TimelineID ||
+                 eventData->timelineID == self.m_transitionToPrevious_TimelineID)) {
+                self.DispatchEffectMessage(SecondSight_API::SecondSightMessage::kEffectStop);
+                AllocationTracker::GetSingleton().EndActivation();
+                APIProxies::EndActivation();
+            }
+            if (!self.m_castQueue.IsEmpty()) {
+                // the camera may be free now, serve the waiting cast once FCFW has finished stopping
+                SKSE::GetTaskInterface()->AddTask([]() {
+                    GetSingleton().ServeCastQueue();
+                });
+            }
             break;
         case FCFW_API::FCFWMessage::kPlaybackWait:
-            auto* eventData = static_cast<FCFW_API::FCFWTimelineEventData*>(a_msg->data);
+            trace.Instant("FCFW::kPlaybackWait", eventData ? eventData->timelineID : 0);
             if (eventData && eventData->timelineID == self.m_transitionToTarget_TimelineID) {
-                // timeline1 playback completed, switch to timeline2 playback
-
-                if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), eventData->timelineID, self.m_atTarget_TimelineID)) {
-                    log::warn("{}: Could not switch playback", __FUNCTION__);
-                }
+                // timeline1 playback completed, the built-in driver has already switched to timeline2 if armed
+                self.SwitchToAtTarget();
             }
             break;
         }
@@ -88,11 +147,13 @@ namespace SecondSight {
         
         switch (static_cast<DTR_API::DTRMessage>(a_msg->type)) {
         case DTR_API::DTRMessage::kLostTarget:
+            GetSingleton().InvalidatePrewarm();
             break;
         case DTR_API::DTRMessage::kFoundTarget:
             auto* eventData = static_cast<DTR_API::DTRTimelineEventData*>(a_msg->data);
             if (eventData && eventData->target) {
-                // found a target
+                // found a target, re-check the prewarmed timelines on the next frame
+                GetSingleton().m_prewarmTimer = std::numeric_limits<float>::max();
             }        
             break;
         }
@@ -103,25 +164,211 @@ namespace SecondSight {
         if (RE::UI::GetSingleton()->GameIsPaused()) {
             return;
         }
+        CaptureFrame();
+
+        if (IsOwnTimeline(m_frame.activeTimelineID)) {
+            if (m_frame.isTargetLoaded) {
+                if (m_lostTargetTime >= 0.f) {
+                    // target 3D re-resolved within the grace period
+                    log::info("{}: Reacquired target after {:.2f} s", __FUNCTION__, m_lostTargetTime);
+                    m_lostTargetTime = -1.f;
+                    if (!APIs::FCFW->ResumePlayback(SKSE::GetPluginHandle(), m_frame.activeTimelineID)) {
+                        log::warn("{}: Could not resume playback", __FUNCTION__);
+                    }
+                }
+                if (GetEffectState(m_frame.activeTimelineID) == SecondSight_API::EffectState::kTransitionToTarget) {
+                    m_handoff.OnTransitionFrame(m_frame.deltaTime);
+                    if (m_longRangePlan.stageCount > 1) {
+                        UpdateLongRangeStage();
+                    }
+                }
+                UpdateHandoff();
+                bool isAtTarget = GetEffectState(m_frame.activeTimelineID) == SecondSight_API::EffectState::kAtTarget;
+                if (m_framingMode == FramingMode::kGroup) {
+                    if (isAtTarget) {
+                        ApplyGroupFraming();
+                    }
+                } else if (!(m_framingMode == FramingMode::kEyes && isAtTarget && ApplyEyesView())) {
+                    ClampFreeRotation();
+                }
+            } else {
+                UpdateLostTarget(m_frame.target);
+            }
+            RecordCameraSample();
+        } else {
+            m_lostTargetTime = -1.f;
+        }
+    }
 
-        if (IsPlaybackActive()) {
-            ClampFreeRotation();
-    
-            if (!(m_target && m_target->Get3D2())) {
-                // lost target
-                StopSecondSightEffect();
+    void FreeCameraManager::CaptureFrame() {
+        m_frame = FrameSnapshot();
+        m_frame.frame = ++m_updateFrame;
+        m_frame.deltaTime = RE::GetSecondsSinceLastFrame();
+
+        if (auto* playerCamera = RE::PlayerCamera::GetSingleton()) {
+            m_frame.worldFOV = playerCamera->worldFOV;
+            if (playerCamera->currentState && playerCamera->currentState->id == RE::CameraState::kFree) {
+                m_frame.freeCameraState = static_cast<RE::FreeCameraState*>(playerCamera->currentState.get());
             }
         }
+        m_frame.cameraPos = _ts_SKSEFunctions::GetCameraPos();
+        auto rotation = _ts_SKSEFunctions::GetCameraRotation();
+        m_frame.cameraRotation = RE::BSTPoint2<float>{ rotation.x, rotation.z };
+        m_frame.activeTimelineID = APIs::FCFW ? APIs::FCFW->GetActiveTimelineID() : 0;
+
+        m_frame.target = GetTarget();
+        if (auto* target = m_frame.target) {
+            m_frame.target3D = target->Get3D2();
+            auto* cell = target->GetParentCell();
+            m_frame.isTargetLoaded = m_frame.target3D && cell && cell->IsAttached();
+            m_frame.targetHeading = target->GetHeading(false);
+        }
     }
-  
-    bool FreeCameraManager::StartSecondSightEffect() {
 
-        UpdateTarget();
-        if (!m_target) {
-            log::warn("{}: No target available to start Second Sight Effect on.", __FUNCTION__);
+    bool FreeCameraManager::IsOwnTimeline(size_t a_timelineID) const {
+        return a_timelineID != 0 &&
+            (a_timelineID == m_transitionToTarget_TimelineID || a_timelineID == m_atTarget_TimelineID || a_timelineID == m_transitionToPrevious_TimelineID);
+    }
+
+    void FreeCameraManager::UpdateLongRangeStage() {
+        auto stage = m_longRangePlan.GetStage(m_handoff.GetElapsed());
+        if (stage == m_longRangeStage) {
+            return;
+        }
+        m_longRangeStage = stage;
+
+        // The destination must stay loaded while the camera approaches it; Update() holds the camera
+        // at the current waypoint (UpdateLostTarget) as soon as the target's 3D or cell detaches.
+        TraceRecorder::GetSingleton().Instant("LongRangeStage", stage);
+        log::debug("{}: Stage {}/{} at {:.2f} s", __FUNCTION__, stage + 1, m_longRangePlan.stageCount, m_handoff.GetElapsed());
+    }
+
+    void FreeCameraManager::UpdateHandoff() {
+        if (m_frame.activeTimelineID != m_atTarget_TimelineID) {
+            return;
+        }
+
+        // counted against the transition's duration, so a kPlaybackWait handled after the next camera update shows up
+        auto held = m_handoff.OnAtTargetFrame();
+        if (!held) {
+            return;
+        }
+        TraceRecorder::GetSingleton().Instant("Handoff", *held);
+        if (*held > 0) {
+            log::debug("{}: At-target tracking started {} frame(s) after the transition ended", __FUNCTION__, *held);
+        }
+    }
+
+    void FreeCameraManager::ArmHandoff() {
+        // FCFW has no equivalent, its handoff waits for kPlaybackWait to reach FCFWMessageHandler
+        bool isArmed = NativeCameraDriver::GetSingleton().ArmSwitch(SKSE::GetPluginHandle(), m_transitionToTarget_TimelineID, m_atTarget_TimelineID);
+        m_handoff.Begin(m_transitionDuration, isArmed);
+    }
+
+    bool FreeCameraManager::SwitchToAtTarget() {
+        auto action = m_handoff.OnPlaybackWait(GetEffectState() == SecondSight_API::EffectState::kTransitionToTarget);
+        if (action == TransitionHandoff::Action::kNone) {
+            // already handed off, or the transition was left
             return false;
         }
+
+        if (action == TransitionHandoff::Action::kSwitch) {
+            TraceScope scope("FCFW::SwitchPlayback");
+            if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), m_transitionToTarget_TimelineID, m_atTarget_TimelineID)) {
+                log::warn("{}: Could not switch playback", __FUNCTION__);
+                return false;
+            }
+        }
+
+        DispatchEffectMessage(SecondSight_API::SecondSightMessage::kArrivedAtTarget);
+        return true;
+    }
+
+    void FreeCameraManager::UpdateLostTarget(RE::Actor* a_target) {
+        if (!m_isFreeCameraActive) {
+            // already returning
+            return;
+        }
+
+        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
+        auto activeTimelineID = m_frame.activeTimelineID;
+
+        // the handle no longer resolves: the actor is gone and cannot be reacquired
+        bool canReacquire = a_target != nullptr;
+
+        if (m_lostTargetTime < 0.f && canReacquire && m_targetGracePeriod > 0.f) {
+            // hold the camera while the target's 3D is re-resolved
+            TraceRecorder::GetSingleton().Instant("LostTarget3D");
+            log::info("{}: Target 3D lost, holding camera for up to {:.2f} s", __FUNCTION__, m_targetGracePeriod);
+            m_lostTargetTime = 0.f;
+            if (!APIs::FCFW->PausePlayback(handle, activeTimelineID)) {
+                log::warn("{}: Could not pause playback", __FUNCTION__);
+            }
+            return;
+        }
+
+        if (m_lostTargetTime >= 0.f) {
+            m_lostTargetTime += m_frame.deltaTime;
+            if (canReacquire && m_lostTargetTime < m_targetGracePeriod) {
+                return;
+            }
+            if (APIs::FCFW->IsPlaybackPaused(handle, activeTimelineID) && !APIs::FCFW->ResumePlayback(handle, activeTimelineID)) {
+                log::warn("{}: Could not resume playback", __FUNCTION__);
+            }
+        }
+
+        // lost target
+        TraceRecorder::GetSingleton().Instant("LostTarget");
+        m_lostTargetTime = -1.f;
+        StopSecondSightEffect();
+    }
+  
+    bool FreeCameraManager::StartSecondSightEffect(CastQueue::Source a_source) {
+        AllocationScope allocations(AllocationTracker::Scope::kActivation);
+
+        if (APIs::FCFW) {
+            auto activeTimelineID = APIs::FCFW->GetActiveTimelineID();
+            if (activeTimelineID != 0 && !IsOwnTimeline(activeTimelineID)) {
+                // another mod owns the camera. Only API casts are queued: the director picks its next cut on its own,
+                // and the Papyrus effect script plays its intro and outro around the call, so a later start
+                // would have no visuals and would not end with the effect.
+                if (a_source != CastQueue::Source::kAPI || m_castQueueTimeout <= 0.f) {
+                    log::info("{}: FCFW is currently playing another timeline.", __FUNCTION__);
+                    return false;
+                }
+                auto timeToLive = std::chrono::duration_cast<CastQueue::Clock::duration>(std::chrono::duration<float>(m_castQueueTimeout));
+                m_castQueue.Push(timeToLive, CastQueue::Clock::now());
+                TraceRecorder::GetSingleton().Instant("CastQueue::Push");
+                log::info("{}: FCFW is currently playing another timeline, queued the cast for up to {:.1f} s", __FUNCTION__, m_castQueueTimeout);
+                return false;
+            }
+        }
+
         if (IsPlaybackActive()) {
+            if (!m_isFreeCameraActive && GetTarget() && APIs::FCFW->GetActiveTimelineID() == m_transitionToPrevious_TimelineID) {
+                // recast while returning: reverse towards the current target
+                m_isFreeCameraActive = true;
+                ToggleFreeCamera();
+                if (APIs::FCFW->GetActiveTimelineID() == m_transitionToPrevious_TimelineID) {
+                    m_isFreeCameraActive = false;
+                    return false;
+                }
+                return true;
+            }
+            return false;
+        }
+
+        // the prewarm selected its target at most one check interval ago, and re-checks when DTR finds one.
+        // An explicit target invalidates the prewarm, so it still goes through the selection.
+        auto* prewarmed = m_prewarmedTarget.get().get();
+        if (prewarmed && IsPrewarmedFor(m_prewarmedTarget) && !prewarmed->IsDead(true)) {
+            m_target = m_prewarmedTarget;
+        } else {
+            UpdateTarget();
+        }
+        m_explicitTarget.reset();
+        if (!GetTarget()) {
+            log::warn("{}: No target available to start Second Sight Effect on.", __FUNCTION__);
             return false;
         }
         if (m_isFreeCameraActive) {
@@ -160,6 +407,74 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
         return true;
     }
 
+    bool FreeCameraManager::StartRewindEffect(float a_seconds) {
+        if (IsPlaybackActive()) {
+            log::info("{}: Rewind is only available when starting the effect", __FUNCTION__);
+            return false;
+        }
+
+        // prewarmed timelines fly to the present
+        InvalidatePrewarm();
+        m_rewindSeconds = std::clamp(a_seconds, 0.f, RewindRecorder::GetSingleton().GetMaxSeconds());
+        bool isStarted = StartSecondSightEffect(CastQueue::Source::kRewind);
+        m_rewindSeconds = 0.f;
+
+        return isStarted;
+    }
+
+    void FreeCameraManager::UpdatePrewarm(float a_delta) {
+        if (!APIs::FCFW || m_isFreeCameraActive) {
+            return;
+        }
+
+        m_prewarmTimer += a_delta;
+        if (m_prewarmTimer < QualityGovernor::GetSingleton().GetRescanInterval(kPrewarmInterval)) {
+            return;
+        }
+        m_prewarmTimer = 0.f;
+
+        if (RE::UI::GetSingleton()->GameIsPaused() || IsPlaybackActive()) {
+            return;
+        }
+
+        UpdateTarget();
+        if (!GetTarget()) {
+            InvalidatePrewarm();
+            return;
+        }
+
+        if (IsPrewarmedFor(m_target)) {
+            return;
+        }
+
+        if (!PrewarmTimelines()) {
+            InvalidatePrewarm();
+        }
+    }
+
+    bool FreeCameraManager::PrewarmTimelines() {
+        if (!UpdateTargetOffset() || !UpdateTimeline1() || !UpdateTimeline2()) {
+            return false;
+        }
+
+        m_prewarmedTarget = m_target;
+        m_prewarmedCameraPos = _ts_SKSEFunctions::GetCameraPos();
+        m_isPrewarmValid = true;
+
+        log::debug("{}: Prewarmed timelines for {}", __FUNCTION__, GetTarget()->GetName());
+        return true;
+    }
+
+    bool FreeCameraManager::IsPrewarmedFor(RE::ActorHandle a_target) const {
+        return m_isPrewarmValid && a_target && a_target == m_prewarmedTarget &&
+               _ts_SKSEFunctions::GetCameraPos().GetDistance(m_prewarmedCameraPos) < kPrewarmTolerance;
+    }
+
+    void FreeCameraManager::InvalidatePrewarm() {
+        m_isPrewarmValid = false;
+        m_prewarmedTarget.reset();
+    }
+
     void FreeCameraManager::StopSecondSightEffect() {
         if (!IsPlaybackActive()) {
             return;
@@ -172,58 +487,125 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
         ToggleFreeCamera();
     }
 
-    void FreeCameraManager::UpdateTarget() {
-        if (APIs::DTR && APIs::DTR->IsReticleActive()) {
-            m_target = APIs::DTR->GetCurrentTarget();
-        } else if (APIs::TrueDirectionalMovementV1 && APIs::TrueDirectionalMovementV1->GetTargetLockState()) {
-            auto targetHandle = APIs::TrueDirectionalMovementV1->GetCurrentTarget();
-            if (targetHandle) {
-                m_target = targetHandle.get().get();
-            } else {
-                m_target = nullptr;
-            }
-        } else {
-            m_target = _ts_SKSEFunctions::GetCrosshairTarget();
-        }
+    void FreeCameraManager::UpdateTarget(const RE::Actor* a_exclude) {
+        TraceScope scope("UpdateTarget");
+
+        Policies::TargetQuery query;
+        query.explicitTarget = m_explicitTarget;
+        query.exclude = a_exclude;
+        query.crosshairDistance = m_isLongRangeEnabled ? m_longRangeMaxDistance : 0.f;
+
+        RE::Actor* target = Policies::ActivePolicies::TargetSelection::Select(query);
 
-        if (m_target && (!GetCameraAnchorPoint() || 
-                (m_target->GetDistance(RE::PlayerCharacter::GetSingleton()) > 8000.f) ||
-                m_target->IsDead(true))) {
-            m_target = nullptr;
+        if (target && (target == a_exclude || !GetCameraAnchorPoint(target) || 
+                (target->GetDistance(RE::PlayerCharacter::GetSingleton()) > (m_isLongRangeEnabled ? m_longRangeMaxDistance : kMaxTargetDistance)) ||
+                target->IsDead(true))) {
+            target = nullptr;
         }
+
+        m_target = target ? target->GetHandle() : RE::ActorHandle();
+    }
+
+    void FreeCameraManager::SetExplicitTarget(RE::Actor* a_target) {
+        m_explicitTarget = a_target ? a_target->GetHandle() : RE::ActorHandle();
+        InvalidatePrewarm();
     }
 
-    RE::NiPointer<RE::NiAVObject> FreeCameraManager::GetCameraAnchorPoint() {
-        RE::NiPointer<RE::NiAVObject> targetPoint = nullptr;
+    RE::Actor* FreeCameraManager::GetEffectTarget() const {
+        return GetEffectState() != SecondSight_API::EffectState::kInactive ? GetTarget() : nullptr;
+    }
 
-        if (!m_target) {
-            return nullptr;
+    SecondSight_API::EffectState FreeCameraManager::GetEffectState() const {
+        if (!APIs::FCFW) {
+            return SecondSight_API::EffectState::kInactive;
         }
 
-        auto race = m_target->GetRace();
-        if (!race) {
-            return nullptr;
+        return GetEffectState(APIs::FCFW->GetActiveTimelineID());
+    }
+
+    SecondSight_API::EffectState FreeCameraManager::GetEffectState(size_t a_activeTimelineID) const {
+        if (a_activeTimelineID == 0) {
+            return SecondSight_API::EffectState::kInactive;
+        } else if (a_activeTimelineID == m_transitionToTarget_TimelineID) {
+            return SecondSight_API::EffectState::kTransitionToTarget;
+        } else if (a_activeTimelineID == m_atTarget_TimelineID) {
+            return SecondSight_API::EffectState::kAtTarget;
+        } else if (a_activeTimelineID == m_transitionToPrevious_TimelineID) {
+            return SecondSight_API::EffectState::kTransitionToPrevious;
         }
+        return SecondSight_API::EffectState::kInactive;
+    }
 
-        RE::BGSBodyPartData* bodyPartData = race->bodyPartData;
-        if (!bodyPartData) {
-            return nullptr;
+    void FreeCameraManager::PublishSnapshot(float a_delta) {
+        Snapshot snapshot;
+        snapshot.state = GetEffectState();
+        snapshot.activeTimelineID = snapshot.state != SecondSight_API::EffectState::kInactive ? APIs::FCFW->GetActiveTimelineID() : 0;
+        snapshot.frame = ++m_snapshotFrame;
+
+        if (snapshot.activeTimelineID != m_snapshotTimelineID) {
+            m_snapshotTimelineID = snapshot.activeTimelineID;
+            m_legElapsed = 0.f;
+        } else if (m_lostTargetTime < 0.f) {
+            // playback is paused while the target is lost
+            m_legElapsed += a_delta;
         }
 
-        auto actor3D = m_target->Get3D2();
-        if (!actor3D) {
-            return nullptr;
+        switch (snapshot.state) {
+        case SecondSight_API::EffectState::kTransitionToTarget:
+            snapshot.legTimeLeft = std::max(m_transitionDuration - m_legElapsed, 0.f);
+            break;
+        case SecondSight_API::EffectState::kAtTarget:
+            snapshot.legTimeLeft = -1.f;
+            break;
+        case SecondSight_API::EffectState::kTransitionToPrevious:
+            snapshot.legTimeLeft = std::max(m_returnDuration - m_legElapsed, 0.f);
+            break;
+        default:
+            break;
         }
-    
-        RE::BGSBodyPart* bodyPart = bodyPartData->parts[RE::BGSBodyPartDefs::LIMB_ENUM::kHead];
-        if (!bodyPart) {
-            bodyPart = bodyPartData->parts[RE::BGSBodyPartDefs::LIMB_ENUM::kTotal];
+
+        if (snapshot.state != SecondSight_API::EffectState::kInactive) {
+            snapshot.target = m_target.native_handle();
         }
-        if (bodyPart) {
-            targetPoint = RE::NiPointer<RE::NiAVObject>(NiAVObject_LookupBoneNodeByName(actor3D, bodyPart->targetName, true));
+
+        m_snapshot.Store(snapshot);
+    }
+
+    void FreeCameraManager::SetFramingMode(FramingMode a_mode) {
+        if (m_framingMode == a_mode) {
+            return;
         }
+        log::info("{}: Framing mode {} -> {}", __FUNCTION__, static_cast<int>(m_framingMode), static_cast<int>(a_mode));
+        m_framingMode = a_mode;
+        InvalidatePrewarm();
+    }
 
-        return targetPoint;
+    void FreeCameraManager::DispatchEffectMessage(SecondSight_API::SecondSightMessage a_message) const {
+        SecondSight_API::SecondSightEventData data{ GetTarget() };
+        SKSE::GetMessagingInterface()->Dispatch(static_cast<std::uint32_t>(a_message), &data, sizeof(data), nullptr);
+    }
+
+    RE::Actor* FreeCameraManager::GetCrosshairTarget(float a_maxTargetDistance, float a_maxTargetScanAngle, const RE::Actor* a_exclude) {
+        auto cameraPos = _ts_SKSEFunctions::GetCameraPos();
+        auto rotation = _ts_SKSEFunctions::GetCameraRotation();
+
+        // camera forward vector from pitch (x) and yaw (z)
+        auto forward = CameraMath::ForwardFromPitchYaw(rotation.x, rotation.z).To<RE::NiPoint3>();
+
+        // the game's view from the last rendered frame, so actors off screen are rejected with the cone test
+        ScreenProjection::Camera camera;
+        std::memcpy(camera.worldToCam, reinterpret_cast<const void*>(g_worldToCamMatrix), sizeof(camera.worldToCam));
+        camera.left = g_viewPort->left;
+        camera.right = g_viewPort->right;
+        camera.top = g_viewPort->top;
+        camera.bottom = g_viewPort->bottom;
+
+        // the grid is synced once per frame from the player update
+        return ActorGrid::GetSingleton().FindCrosshairTarget(cameraPos, forward, a_maxTargetDistance, a_maxTargetScanAngle, a_exclude, &camera);
+    }
+
+    RE::NiPointer<RE::NiAVObject> FreeCameraManager::GetCameraAnchorPoint(RE::Actor* a_actor) {
+        return Policies::ActivePolicies::Anchor::Get(a_actor);
     }
 
     bool FreeCameraManager::IsPlaybackActive() const { 
@@ -233,6 +615,7 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
         }
         SKSE::PluginHandle handle = SKSE::GetPluginHandle();
 
+        TraceScope scope("FCFW::IsPlaybackRunning");
         if (APIs::FCFW->IsPlaybackRunning(handle, m_transitionToTarget_TimelineID) ||
             APIs::FCFW->IsPlaybackRunning(handle, m_atTarget_TimelineID) ||
             APIs::FCFW->IsPlaybackRunning(handle, m_transitionToPrevious_TimelineID)) {
@@ -242,25 +625,20 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
         return false;
     }
 
-    bool FreeCameraManager::InitializePlayback() {
+    bool FreeCameraManager::InitializePlayback(bool a_updateOffset) {
         if (IsPlaybackActive()) {
             return false;
         }
 
-        auto targetPoint = GetCameraAnchorPoint();
-        if (!targetPoint) {
-            log::error("{}: Could not obtain target point.", __FUNCTION__);
-            return false;
-        }
-
         RE::PlayerCamera* playerCamera = RE::PlayerCamera::GetSingleton();
         if (!playerCamera) {
             log::error("{}: PlayerCamera singleton not found", __FUNCTION__);
             return false;
         }
 
-        m_offset = targetPoint->world.translate - m_target->GetPosition();
-        m_offset.y += 20.f; // move 20 units into 'forward' direction to account for head dimensions
+        if (a_updateOffset && !UpdateTargetOffset()) {
+            return false;
+        }
 
         m_previousCameraPos = _ts_SKSEFunctions::GetCameraPos();
 
@@ -286,6 +664,148 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
 
         m_prevFreeRotation = thirdPersonState ? thirdPersonState->freeRotation : RE::NiPoint2{ 0.0f, 0.0f };
 
+        m_cameraSampleCount = 0;
+
+        return true;
+    }
+
+    void FreeCameraManager::RecordCameraSample() {
+        auto& sample = m_cameraSamples[m_cameraSampleIndex];
+        sample.position = m_frame.cameraPos;
+        sample.rotation = m_frame.cameraRotation;
+        sample.deltaTime = m_frame.deltaTime;
+
+        m_cameraSampleIndex = (m_cameraSampleIndex + 1) % kCameraSampleCount;
+        m_cameraSampleCount = std::min(m_cameraSampleCount + 1, kCameraSampleCount);
+    }
+
+    bool FreeCameraManager::EstimateCameraVelocity(RE::NiPoint3& a_linear, RE::BSTPoint2<float>& a_angular) const {
+        if (m_cameraSampleCount < 2) {
+            return false;
+        }
+
+        size_t newest = (m_cameraSampleIndex + kCameraSampleCount - 1) % kCameraSampleCount;
+        size_t oldest = (m_cameraSampleIndex + kCameraSampleCount - m_cameraSampleCount) % kCameraSampleCount;
+
+        // time spanned by the samples after the oldest one
+        float elapsed = 0.f;
+        for (size_t i = 1; i < m_cameraSampleCount; ++i) {
+            elapsed += m_cameraSamples[(oldest + i) % kCameraSampleCount].deltaTime;
+        }
+        if (elapsed <= 0.f) {
+            return false;
+        }
+
+        auto& from = m_cameraSamples[oldest];
+        auto& to = m_cameraSamples[newest];
+        a_linear = (to.position - from.position) / elapsed;
+        float deltas[2] = { to.rotation.x - from.rotation.x, to.rotation.y - from.rotation.y };
+        CameraMath::NormalizeAngles(deltas, 2);
+        a_angular.x = deltas[0] / elapsed;
+        a_angular.y = deltas[1] / elapsed;
+
+        return true;
+    }
+
+    void FreeCameraManager::AddPresetPoints(CameraPresets::Leg a_leg, size_t a_timelineID, float a_duration) {
+        using Anchor = CameraPresets::Anchor;
+        using Channel = CameraPresets::Channel;
+
+        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
+        RE::BSTPoint2<float> rotationOffset = RE::BSTPoint2<float>(); // no offset
+
+        auto* target = GetTarget();
+        // on the way back the target may have been unloaded, skip its keyframes in that case
+        bool hasTarget = target && (a_leg != CameraPresets::Leg::kTransitionToPrevious || target->Get3D2());
+        // group framing replaces the target's head with the computed group viewpoint
+        bool isGroupFraming = m_framingMode == FramingMode::kGroup && m_groupFraming.GetCount() > 0;
+
+        RE::NiPoint3 velocity;
+        RE::BSTPoint2<float> angularVelocity;
+        bool isMoving = IsPlaybackActive() && EstimateCameraVelocity(velocity, angularVelocity) && velocity.Length() > 10.f;
+        bool hasCameraStart[2] = { false, false };
+
+        int ret;
+        for (auto& keyframe : CameraPresets::GetSingleton().GetLeg(a_leg)) {
+            float time = keyframe.time * a_duration;
+            bool easeIn = keyframe.easeIn != 0;
+            bool easeOut = keyframe.easeOut != 0;
+            bool isTranslation = keyframe.channel == Channel::kTranslation;
+
+            switch (keyframe.anchor) {
+            case Anchor::kCamera:
+                if (isMoving && time == 0.f) {
+                    // Interrupting a leg in flight: start without easing, the lead point below carries the velocity
+                    hasCameraStart[static_cast<size_t>(keyframe.channel)] = true;
+                    easeIn = easeOut = false;
+                }
+                if (isTranslation) {
+                    ret = APIs::FCFW->AddTranslationPointAtCamera(handle, a_timelineID, time, easeIn, easeOut);
+                } else {
+                    ret = APIs::FCFW->AddRotationPointAtCamera(handle, a_timelineID, time, easeIn, easeOut);
+                }
+                break;
+            case Anchor::kTarget:
+                if (!hasTarget) {
+                    break;
+                }
+                if (isGroupFraming) {
+                    if (isTranslation) {
+                        ret = APIs::FCFW->AddTranslationPoint(handle, a_timelineID, time, m_groupCameraPos, easeIn, easeOut);
+                    } else {
+                        ret = APIs::FCFW->AddRotationPoint(handle, a_timelineID, time, m_groupCameraRotation.To<RE::BSTPoint2<float>>(), easeIn, easeOut);
+                    }
+                } else if (isTranslation) {
+                    ret = APIs::FCFW->AddTranslationPointAtRef(handle, a_timelineID, time, target, m_offset, true, easeIn, easeOut);
+                } else {
+                    ret = APIs::FCFW->AddRotationPointAtRef(handle, a_timelineID, time, target, rotationOffset, true, easeIn, easeOut);
+                }
+                break;
+            case Anchor::kTargetLookAt:
+                if (hasTarget) {
+                    ret = APIs::FCFW->AddRotationPointAtRef(handle, a_timelineID, time, target, rotationOffset, false, easeIn, easeOut);
+                }
+                break;
+            case Anchor::kReturn:
+                if (isTranslation) {
+                    ret = APIs::FCFW->AddTranslationPoint(handle, a_timelineID, time, m_previousCameraPos, easeIn, easeOut);
+                } else {
+                    ret = APIs::FCFW->AddRotationPoint(handle, a_timelineID, time, m_prevRotation, easeIn, easeOut);
+                }
+                break;
+            }
+        }
+
+        if (!hasCameraStart[0] && !hasCameraStart[1]) {
+            return;
+        }
+
+        // Add a lead point along the current velocity, so the tangent at the start of the new path
+        // matches the camera's motion (C1)
+        auto& current = m_cameraSamples[(m_cameraSampleIndex + kCameraSampleCount - 1) % kCameraSampleCount];
+        if (hasCameraStart[static_cast<size_t>(Channel::kTranslation)]) {
+            ret = APIs::FCFW->AddTranslationPoint(handle, a_timelineID, kVelocityLeadTime, current.position + velocity * kVelocityLeadTime, false, false);
+        }
+        if (hasCameraStart[static_cast<size_t>(Channel::kRotation)]) {
+            RE::BSTPoint2<float> leadRotation{
+                current.rotation.x + angularVelocity.x * kVelocityLeadTime,
+                CameraMath::NormalizeAngle(current.rotation.y + angularVelocity.y * kVelocityLeadTime)
+            };
+            ret = APIs::FCFW->AddRotationPoint(handle, a_timelineID, kVelocityLeadTime, leadRotation, false, false);
+        }
+    }
+
+    bool FreeCameraManager::UpdateTargetOffset() {
+        auto* target = GetTarget();
+        auto targetPoint = GetCameraAnchorPoint(target);
+        if (!targetPoint) {
+            log::error("{}: Could not obtain target point.", __FUNCTION__);
+            return false;
+        }
+
+        m_offset = targetPoint->world.translate - target->GetPosition();
+        m_offset.y += 20.f; // move 20 units into 'forward' direction to account for head dimensions
+
         return true;
     }
 
@@ -297,11 +817,13 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
         SKSE::PluginHandle handle = SKSE::GetPluginHandle();
 
         if (a_timelineID != 0) {
+            TraceScope scope("FCFW::ClearTimeline");
             if (!APIs::FCFW->ClearTimeline(handle, a_timelineID)) {
                 log::error("{}: Could not clear timeline.", __FUNCTION__);
                 return false;
             }
         } else {
+            TraceScope scope("FCFW::RegisterTimeline");
             a_timelineID = APIs::FCFW->RegisterTimeline(handle);
         }
         if (a_timelineID == 0) {
@@ -313,13 +835,16 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
     }
 
     bool FreeCameraManager::UpdateTimeline1() { 
-        
+        TraceScope scope("UpdateTimeline1");
+
         if (!APIs::FCFW) {
             log::error("{}: FCFW API not available, cannot update timeline", __FUNCTION__);
             return false;
         }
 
-        if (!InitializePlayback()) {
+        auto* target = GetTarget();
+        if (!target) {
+            log::error("{}: No target available", __FUNCTION__);
             return false;
         }
 
@@ -327,48 +852,126 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
             return false;
         }
 
-        float transitionTime = ComputeTransitionTime(m_target->GetPosition());
+        if (m_framingMode == FramingMode::kGroup) {
+            UpdateGroupMembers();
+            auto* playerCamera = RE::PlayerCamera::GetSingleton();
+            UpdateGroupFraming(true, playerCamera ? playerCamera->worldFOV : 75.f, _ts_SKSEFunctions::GetCameraPos());
+        }
 
-        float rotationToMovement_End = 0.2f * transitionTime; // The time the camera finishes rotating towards the movement direction
-        float rotationToTarget_Start = 0.5f * transitionTime; // the time the camera starts rotating towards the target
+        float transitionTime = ComputeTransitionTime(target->GetPosition());
 
-        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
-        RE::BSTPoint2<float> rotationOffset = RE::BSTPoint2<float>(); // no offset
+        // beyond the regular range the flight is split into stages along an arc
+        m_longRangePlan = LongRange::Plan();
+        m_longRangeStage = 0;
 
+        if (m_rewindSeconds > 0.f && m_framingMode != FramingMode::kGroup) {
+            if (!AddRewindPoints(target, m_transitionToTarget_TimelineID)) {
+                log::info("{}: Not enough history to rewind {}, flying to the present", __FUNCTION__, target->GetName());
+            } else if (APIs::FCFW->SetPlaybackMode(SKSE::GetPluginHandle(), m_transitionToTarget_TimelineID, 2)) {
+                return true;
+            } else {
+                // without wait mode the rewind never reports kPlaybackWait and never hands off to the at-target view
+                log::warn("{}: Could not set wait mode for the rewind, flying to the present", __FUNCTION__);
+                if (!InitializeTimeline(m_transitionToTarget_TimelineID)) {
+                    return false;
+                }
+            }
+        }
+
+        auto cameraPos = _ts_SKSEFunctions::GetCameraPos();
+        auto destination = m_framingMode == FramingMode::kGroup && m_groupFraming.GetCount() > 0 ? m_groupCameraPos : target->GetPosition() + m_offset;
+        if (m_isLongRangeEnabled && cameraPos.GetDistance(destination) > kMaxTargetDistance) {
+            m_longRangePlan = LongRange::BuildPlan(CameraMath::Vec3::From(cameraPos), CameraMath::Vec3::From(destination), transitionTime, m_longRangeSettings);
+            log::info("{}: Long range flight over {:.0f} units in {} stages, {:.2f} s", __FUNCTION__,
+                cameraPos.GetDistance(destination), m_longRangePlan.stageCount, transitionTime);
+        }
+
+        AddPresetPoints(CameraPresets::Leg::kTransitionToTarget, m_transitionToTarget_TimelineID, transitionTime);
+        m_transitionDuration = transitionTime;
+
+        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
         int ret;
-        ret = APIs::FCFW->AddTranslationPointAtCamera(handle, m_transitionToTarget_TimelineID, 0.0f, true, true);
-        ret = APIs::FCFW->AddRotationPointAtCamera(handle, m_transitionToTarget_TimelineID, 0.f, true, true);
-        ret = APIs::FCFW->AddRotationPointAtRef(handle, m_transitionToTarget_TimelineID, rotationToMovement_End, m_target, rotationOffset, false, true, true);
-        ret = APIs::FCFW->AddRotationPointAtRef(handle, m_transitionToTarget_TimelineID, rotationToTarget_Start, m_target, rotationOffset, false, true, true);
-        ret = APIs::FCFW->AddTranslationPointAtRef(handle, m_transitionToTarget_TimelineID, transitionTime, m_target, m_offset, true, true, true);
-        ret = APIs::FCFW->AddRotationPointAtRef(handle, m_transitionToTarget_TimelineID, transitionTime, m_target, rotationOffset, true, true, true);
+        // intermediate waypoints, the last stage ends at the preset's target keyframe
+        for (size_t i = 0; i + 1 < m_longRangePlan.stageCount; ++i) {
+            auto& stage = m_longRangePlan.stages[i];
+            ret = APIs::FCFW->AddTranslationPoint(handle, m_transitionToTarget_TimelineID, stage.endTime, stage.end.To<RE::NiPoint3>(), false, false);
+        }
         ret = APIs::FCFW->SetPlaybackMode(handle, m_transitionToTarget_TimelineID, 2);
 
         return true;     
     }
 
+    bool FreeCameraManager::AddRewindPoints(RE::Actor* a_target, size_t a_timelineID) {
+        m_rewindPath.clear();
+        if (!RewindRecorder::GetSingleton().GetPath(a_target, m_rewindSeconds, m_rewindPath)) {
+            return false;
+        }
+
+        // the target offset turned by the heading the target had at the time
+        auto anchor = [this](const RewindBuffer::Sample& a_sample) {
+            float sinHeading = std::sin(a_sample.heading);
+            float cosHeading = std::cos(a_sample.heading);
+            return RE::NiPoint3(a_sample.x + m_offset.x * cosHeading + m_offset.y * sinHeading,
+                a_sample.y - m_offset.x * sinHeading + m_offset.y * cosHeading,
+                a_sample.z + m_offset.z);
+        };
+
+        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
+        auto& first = m_rewindPath.front();
+        float flyTime = ComputeTransitionTime(anchor(first));
+        int ret = APIs::FCFW->AddTranslationPointAtCamera(handle, a_timelineID, 0.f, true, false);
+        ret = APIs::FCFW->AddRotationPointAtCamera(handle, a_timelineID, 0.f, true, false);
+
+        float time = flyTime;
+        for (auto& sample : m_rewindPath) {
+            time = flyTime + (sample.time - first.time) / kRewindReplaySpeed;
+            ret = APIs::FCFW->AddTranslationPoint(handle, a_timelineID, time, anchor(sample), false, false);
+            ret = APIs::FCFW->AddRotationPoint(handle, a_timelineID, time, RE::BSTPoint2<float>{ 0.f, CameraMath::NormalizeAngle(sample.heading) }, false, false);
+        }
+
+        // the target kept moving during the flight and the replay, catch up with it
+        auto& last = m_rewindPath.back();
+        float catchUpDistance = a_target->GetPosition().GetDistance(RE::NiPoint3(last.x, last.y, last.z));
+        time += std::clamp(catchUpDistance / kRewindCatchUpSpeed, 0.5f, 2.f);
+        ret = APIs::FCFW->AddTranslationPointAtRef(handle, a_timelineID, time, a_target, m_offset, true, false, true);
+        ret = APIs::FCFW->AddRotationPointAtRef(handle, a_timelineID, time, a_target, RE::BSTPoint2<float>(), true, false, true);
+        m_transitionDuration = time;
+
+        log::info("{}: Rewinding {:.1f} s of {} ({} samples), {:.2f} s", __FUNCTION__, last.time - first.time,
+            a_target->GetName(), m_rewindPath.size(), time);
+        return true;
+    }
+
     bool FreeCameraManager::UpdateTimeline2() { 
+        TraceScope scope("UpdateTimeline2");
+
         if (!APIs::FCFW) {
             return false;
         }
         
+        auto* target = GetTarget();
+        if (!target) {
+            log::error("{}: No target available", __FUNCTION__);
+            return false;
+        }
+
         if (!InitializeTimeline(m_atTarget_TimelineID)) {
             return false;
         }
 
-        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
-        RE::BSTPoint2<float> rotationOffset = RE::BSTPoint2<float>(); // no offset
+        AddPresetPoints(CameraPresets::Leg::kAtTarget, m_atTarget_TimelineID, 0.f);
+        m_isEyesCalibrated = false;
 
-        int ret;
-        ret = APIs::FCFW->AddTranslationPointAtRef(handle, m_atTarget_TimelineID, 0.f, m_target, m_offset, true, true, true);
-        ret = APIs::FCFW->AddRotationPointAtRef(handle, m_atTarget_TimelineID, 0.f, m_target, rotationOffset, true, true, true);
-        ret = APIs::FCFW->SetPlaybackMode(handle, m_atTarget_TimelineID, 2);
+        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
+        int ret = APIs::FCFW->SetPlaybackMode(handle, m_atTarget_TimelineID, 2);
         APIs::FCFW->AllowUserRotation(handle, m_atTarget_TimelineID, true);
 
         return true;     
     }
 
     bool FreeCameraManager::UpdateTimeline3() {   
+        TraceScope scope("UpdateTimeline3");
+
         if (!APIs::FCFW) {
             return false;
         }
@@ -379,42 +982,227 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
 
         float transitionTime = ComputeTransitionTime(m_previousCameraPos);
 
-        SKSE::PluginHandle handle = SKSE::GetPluginHandle();
-        RE::BSTPoint2<float> rotationOffset = RE::BSTPoint2<float>(); // no offset
-        
-        int ret;
-        ret = APIs::FCFW->AddTranslationPointAtCamera(handle, m_transitionToPrevious_TimelineID, 0.0f, true, true);
-        ret = APIs::FCFW->AddRotationPointAtCamera(handle, m_transitionToPrevious_TimelineID, 0.f, true, true);
-        ret = APIs::FCFW->AddRotationPointAtRef(handle, m_transitionToPrevious_TimelineID, 0.5f * transitionTime, m_target, rotationOffset, false, true, true);
-        ret = APIs::FCFW->AddTranslationPoint(handle, m_transitionToPrevious_TimelineID, transitionTime, m_previousCameraPos, true, true);
-        ret = APIs::FCFW->AddRotationPoint(handle, m_transitionToPrevious_TimelineID, transitionTime, m_prevRotation, true, true);
+        AddPresetPoints(CameraPresets::Leg::kTransitionToPrevious, m_transitionToPrevious_TimelineID, transitionTime);
+        m_returnDuration = transitionTime;
 
         return true;     
     }
 
     void FreeCameraManager::ClampFreeRotation() {
-        auto* playerCamera = RE::PlayerCamera::GetSingleton();
-        RE::FreeCameraState* freeCameraState = nullptr;
-
-        if (playerCamera && playerCamera->currentState && (playerCamera->currentState->id == RE::CameraState::kFree)) {
-            freeCameraState = static_cast<RE::FreeCameraState*>(playerCamera->currentState.get());
-        }
-        
+        auto* freeCameraState = m_frame.freeCameraState;
         if (!freeCameraState) {
             log::warn("{}: Not in Free Camera State", __FUNCTION__);
 			return;
 		}
 
-        float heading = m_target->GetHeading(false);
-        
-        // Clamp pitch
-        freeCameraState->rotation.x = _ts_SKSEFunctions::NormalRelativeAngle(freeCameraState->rotation.x);
-        freeCameraState->rotation.x = std::clamp(freeCameraState->rotation.x, - 0.45f * PI, 0.4f * PI);
-        
-        // Clamp yaw
-        float relativeYaw = _ts_SKSEFunctions::NormalRelativeAngle(freeCameraState->rotation.y - heading);
-        relativeYaw = std::clamp(relativeYaw, -0.5f * PI, 0.5f * PI);
-        freeCameraState->rotation.y = _ts_SKSEFunctions::NormalRelativeAngle(heading + relativeYaw);
+        if (!m_frame.target) {
+            return;
+        }
+
+        float heading = m_frame.targetHeading;
+
+        // pitch and yaw clamped relative to the target's heading
+        auto clamp = [heading](float a_pitch, float a_yaw, bool* a_isClamped = nullptr) {
+            float angles[2] = { a_pitch, a_yaw - heading };
+            CameraMath::NormalizeAngles(angles, 2);
+            float pitch = std::clamp(angles[0], -0.45f * PI, 0.4f * PI);
+            float relativeYaw = std::clamp(angles[1], -0.5f * PI, 0.5f * PI);
+            if (a_isClamped) {
+                *a_isClamped = pitch != angles[0] || relativeYaw != angles[1];
+            }
+            return CameraMath::PitchYaw{ pitch, CameraMath::NormalizeAngle(heading + relativeYaw) };
+        };
+
+        bool isClamped = false;
+        auto clamped = clamp(freeCameraState->rotation.x, freeCameraState->rotation.y, &isClamped);
+        bool isContinued = m_clampFrame + 1 == m_frame.frame;
+        m_clampFrame = m_frame.frame;
+
+        float blendRate = QualityGovernor::GetSingleton().GetClampBlendRate(kClampBlendRate);
+        if (blendRate > 0.f && isContinued && isClamped) {
+            // pushed past the limit: ease from last frame's rotation into the limit instead of stopping dead.
+            // Both ends are within the range, and the result is clamped again, so it never leaves the range.
+            float blend = 1.f - std::exp(-blendRate * m_frame.deltaTime);
+            auto blended = CameraMath::Slerp(m_clampRotation, clamped, blend);
+            clamped = clamp(blended.pitch, blended.yaw);
+        }
+
+        m_clampRotation = clamped;
+        freeCameraState->rotation = clamped.To<RE::BSTPoint2<float>>();
+    }
+
+    void FreeCameraManager::UpdateGroupMembers() {
+        TraceScope scope("UpdateGroupMembers");
+
+        m_groupFraming.Clear();
+        m_groupRescanTimer = 0.f;
+
+        auto* target = GetTarget();
+        if (!target) {
+            return;
+        }
+
+        auto addMember = [this](RE::Actor* a_actor) {
+            auto anchor = GetCameraAnchorPoint(a_actor);
+            if (!anchor) {
+                return;
+            }
+            auto index = m_groupFraming.AddPoint(CameraMath::Vec3::From(anchor->world.translate));
+            if (index < m_groupMembers.size()) {
+                m_groupMembers[index] = a_actor->GetHandle();
+            }
+        };
+
+        // the target is always part of the group
+        addMember(target);
+
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        ActorGrid::GetSingleton().ForEachInRadius(target->GetPosition(), kGroupRadius, [&](RE::Actor* a_actor) {
+            if (a_actor != target && a_actor != player && !a_actor->IsDead(true)) {
+                addMember(a_actor);
+            }
+        });
+
+        log::debug("{}: {} actors in group", __FUNCTION__, m_groupFraming.GetCount());
+    }
+
+    bool FreeCameraManager::UpdateGroupFraming(bool a_snap, float a_worldFOV, const RE::NiPoint3& a_cameraPos) {
+        TraceScope scope("UpdateGroupFraming");
+
+        // move the points of actors that are still around, drop the others
+        for (size_t i = 0; i < m_groupFraming.GetCount();) {
+            auto actor = m_groupMembers[i].get();
+            auto anchor = actor ? GetCameraAnchorPoint(actor.get()) : nullptr;
+            if (!anchor) {
+                m_groupMembers[i] = m_groupMembers[m_groupFraming.GetCount() - 1];
+                m_groupFraming.RemovePoint(i);
+                continue;
+            }
+            m_groupFraming.SetPoint(i, CameraMath::Vec3::From(anchor->world.translate));
+            ++i;
+        }
+
+        if (m_groupFraming.GetCount() == 0) {
+            return false;
+        }
+
+        auto bounds = m_groupFraming.Compute();
+
+        // fit the bounding sphere into the narrower of the horizontal and vertical FOV
+        float horizontalHalfFov = 0.5f * a_worldFOV * CameraMath::kPi / 180.f;
+        float verticalHalfFov = std::atan(std::tan(horizontalHalfFov) / kGroupAspectRatio);
+        float distance = std::max(bounds.radius, kMinGroupRadius) / std::sin(std::min(horizontalHalfFov, verticalHalfFov));
+
+        // look across the principal axis so the group spreads over the screen width,
+        // from the side the camera is currently on
+        auto toCamera = CameraMath::Vec3::From(a_cameraPos) - bounds.center;
+        auto side = CameraMath::Normalize(CameraMath::Vec3(bounds.axis.Y(), -bounds.axis.X(), 0.f));
+        if (CameraMath::Dot(side, side) == 0.f) {
+            // the group is stacked vertically
+            side = CameraMath::Normalize(CameraMath::Vec3(toCamera.X(), toCamera.Y(), 0.f));
+        }
+        if (CameraMath::Dot(side, toCamera) < 0.f) {
+            side = -side;
+        }
+        auto viewFrom = CameraMath::Normalize(side + CameraMath::Vec3(0.f, 0.f, std::tan(kGroupPitch)));
+
+        auto cameraPos = bounds.center + viewFrom * distance;
+        auto cameraRotation = CameraMath::LookAt(cameraPos, bounds.center, m_groupCameraRotation.yaw);
+
+        if (a_snap) {
+            m_groupCameraPos = cameraPos.To<RE::NiPoint3>();
+            m_groupCameraRotation = cameraRotation;
+        } else {
+            // only ApplyGroupFraming() blends, during Update()
+            float blend = 1.f - std::exp(-kGroupFramingRate * m_frame.deltaTime);
+            m_groupCameraPos = CameraMath::Lerp(CameraMath::Vec3::From(m_groupCameraPos), cameraPos, blend).To<RE::NiPoint3>();
+            m_groupCameraRotation = CameraMath::Slerp(m_groupCameraRotation, cameraRotation, blend);
+        }
+
+        return true;
+    }
+
+    void FreeCameraManager::ApplyGroupFraming() {
+        auto* freeCameraState = m_frame.freeCameraState;
+        if (!freeCameraState) {
+            return;
+        }
+
+        m_groupRescanTimer += m_frame.deltaTime;
+        if (m_groupRescanTimer >= QualityGovernor::GetSingleton().GetRescanInterval(kGroupRescanInterval)) {
+            UpdateGroupMembers();
+        }
+
+        if (!UpdateGroupFraming(false, m_frame.worldFOV, m_frame.cameraPos)) {
+            return;
+        }
+
+        freeCameraState->translation = m_groupCameraPos;
+        freeCameraState->rotation = m_groupCameraRotation.To<RE::BSTPoint2<float>>();
+    }
+
+    RE::NiTransform FreeCameraManager::ComposeWorldTransform(RE::NiAVObject* a_node, const RE::NiAVObject* a_root) {
+        std::array<RE::NiAVObject*, kMaxBoneDepth> chain;
+        size_t depth = 0;
+        RE::NiAVObject* node = a_node;
+        for (; node && node != a_root && depth < chain.size(); node = node->parent) {
+            chain[depth++] = node;
+        }
+        if (node != a_root) {
+            // not below a_root
+            return a_node->world;
+        }
+
+        RE::NiTransform world = a_root->world;
+        while (depth > 0) {
+            world = world * chain[--depth]->local;
+        }
+        return world;
+    }
+
+    bool FreeCameraManager::ApplyEyesView() {
+        auto* freeCameraState = m_frame.freeCameraState;
+        if (!freeCameraState) {
+            return false;
+        }
+
+        auto* target = m_frame.target;
+        auto head = GetCameraAnchorPoint(target);
+        auto* root = m_frame.target3D;
+        if (!head || !root) {
+            return false;
+        }
+
+        // The animation update for this frame has already written the bones' local transforms, but their
+        // world transforms are only propagated later in the frame. Composing the chain here gives the
+        // current frame's head pose instead of last frame's.
+        auto headWorld = ComposeWorldTransform(head.get(), root);
+        float scale = headWorld.scale > 0.f ? headWorld.scale : 1.f;
+
+        if (!m_isEyesCalibrated) {
+            // Express the target's facing in head bone space once, so the view follows the head's
+            // motion without depending on the skeleton's bone axis conventions
+            float heading = m_frame.targetHeading;
+            auto facing = CameraMath::ForwardFromPitchYaw(0.f, heading).To<RE::NiPoint3>();
+            auto toHeadSpace = headWorld.rotate.Transpose();
+            m_eyesLocalForward = toHeadSpace * facing;
+            m_eyesLocalOffset = toHeadSpace * (facing * kEyeForwardOffset + RE::NiPoint3(0.f, 0.f, kEyeUpOffset)) / scale;
+            m_eyesRotation = CameraMath::PitchYaw{ 0.f, heading };
+            m_isEyesCalibrated = true;
+        }
+
+        auto forward = headWorld.rotate * m_eyesLocalForward;
+        auto position = headWorld.translate + headWorld.rotate * m_eyesLocalOffset * scale;
+        auto rotation = CameraMath::LookAt(CameraMath::Vec3::From(forward), m_eyesRotation.yaw);
+        if (m_eyesStabilization > 0.f) {
+            float blend = 1.f - std::exp(-m_eyesStabilization * m_frame.deltaTime);
+            rotation = CameraMath::Slerp(m_eyesRotation, rotation, blend);
+        }
+        m_eyesRotation = rotation;
+
+        freeCameraState->translation = position;
+        freeCameraState->rotation = rotation.To<RE::BSTPoint2<float>>();
+        return true;
     }
 
     void FreeCameraManager::ToggleFreeCamera() {
@@ -429,31 +1217,57 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
 
         auto activeTimelineID = APIs::FCFW->GetActiveTimelineID();
         if (activeTimelineID == 0) {
-            if (!UpdateTimeline1()) {
-                log::warn("{}: Could not update timeline1", __FUNCTION__);
+            // prewarmed timelines only need the return point captured
+            bool isPrewarmed = IsPrewarmedFor(m_target);
+            InvalidatePrewarm();
+
+            if (!InitializePlayback(!isPrewarmed)) {
+                log::warn("{}: Could not initialize playback", __FUNCTION__);
                 return;
             }
-            if (!UpdateTimeline2()) {
-                log::warn("{}: Could not update timeline2", __FUNCTION__);
-                return;
+            if (!isPrewarmed) {
+                if (!UpdateTimeline1()) {
+                    log::warn("{}: Could not update timeline1", __FUNCTION__);
+                    return;
+                }
+                if (!UpdateTimeline2()) {
+                    log::warn("{}: Could not update timeline2", __FUNCTION__);
+                    return;
+                }
             }
 
+            TraceScope scope("FCFW::StartPlayback");
             if (!APIs::FCFW->StartPlayback(SKSE::GetPluginHandle(), m_transitionToTarget_TimelineID,
                 1.0f, false, false, false, 0.0f, true, 100.0f /*a_minHeightAboveGround*/, true /*a_showMenusDuringPlayback*/)) {
                 log::warn("{}: Could not start playback", __FUNCTION__);
+            } else {
+                ArmHandoff();
+                DispatchEffectMessage(SecondSight_API::SecondSightMessage::kEffectStart);
             }
         } else if (activeTimelineID == m_transitionToTarget_TimelineID || activeTimelineID == m_atTarget_TimelineID) {
             if (!UpdateTimeline3()) {
                 log::warn("{}: Could not update timeline3", __FUNCTION__);
                 return;
             }
+            TraceScope scope("FCFW::SwitchPlayback");
             if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), activeTimelineID, m_transitionToPrevious_TimelineID)) {
                 log::warn("{}: Could not switch playback", __FUNCTION__);
+            } else {
+                DispatchEffectMessage(SecondSight_API::SecondSightMessage::kReturnStart);
             }
 
         } else if (activeTimelineID == m_transitionToPrevious_TimelineID) {
+            // timeline1 was built from the original start position, rebuild it from the live camera state
+            if (!UpdateTargetOffset() || !UpdateTimeline1()) {
+                log::warn("{}: Could not update timeline1", __FUNCTION__);
+                return;
+            }
+            TraceScope scope("FCFW::SwitchPlayback");
             if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), activeTimelineID, m_transitionToTarget_TimelineID)) {
                 log::warn("{}: Could not switch playback", __FUNCTION__);
+            } else {
+                ArmHandoff();
+                DispatchEffectMessage(SecondSight_API::SecondSightMessage::kEffectStart);
             }
         } else {
             log::info("{}: FCFW is currently playing another timeline.", __FUNCTION__);
@@ -476,31 +1290,103 @@ auto* playerCamera = RE::PlayerCamera::GetSingleton();
                 log::warn("{}: Could not update timeline3", __FUNCTION__);
                 return;
             }
+            TraceScope scope("FCFW::SwitchPlayback");
             if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), activeTimelineID, m_transitionToPrevious_TimelineID)) {
                 log::warn("{}: Could not switch playback", __FUNCTION__);
+            } else {
+                DispatchEffectMessage(SecondSight_API::SecondSightMessage::kReturnStart);
             }
 
         }
     }
 
+    void FreeCameraManager::ServeCastQueue() {
+        if (!APIs::FCFW || APIs::FCFW->GetActiveTimelineID() != 0) {
+            // another timeline took over, wait for it to stop
+            return;
+        }
+
+        auto now = CastQueue::Clock::now();
+        auto request = m_castQueue.Pop(now);
+        if (!request) {
+            return;
+        }
+
+        auto wait = std::chrono::duration<float>(now - request->enqueued).count();
+        TraceRecorder::GetSingleton().Instant("CastQueue::Serve");
+        log::info("{}: Starting queued cast after waiting {:.2f} s", __FUNCTION__, wait);
+
+        if (StartSecondSightEffect(CastQueue::Source::kAPI)) {
+            m_castQueue.RecordServed(*request, now);
+        } else {
+            m_castQueue.RecordFailed();
+            log::info("{}: Queued cast could not be started", __FUNCTION__);
+        }
+    }
+
+    bool FreeCameraManager::HopToNextTarget() {
+        if (RE::UI::GetSingleton()->GameIsPaused()) {
+            return false;
+        }
+
+        if (!APIs::FCFW) {
+            log::error("{}: FCFW API not available", __FUNCTION__);
+            return false;
+        }
+
+        auto activeTimelineID = APIs::FCFW->GetActiveTimelineID();
+        if (activeTimelineID == 0 || activeTimelineID != m_atTarget_TimelineID) {
+            log::info("{}: Not at a target, cannot hop.", __FUNCTION__);
+            return false;
+        }
+
+        auto previousTarget = m_target;
+        auto previousOffset = m_offset;
+
+        // acquire the next target, the return point of the original cast is kept
+        UpdateTarget(GetTarget());
+        m_explicitTarget.reset();
+        if (!GetTarget()) {
+            log::info("{}: No new target available to hop to.", __FUNCTION__);
+            m_target = previousTarget;
+            return false;
+        }
+
+        if (!UpdateTargetOffset() || !UpdateTimeline1()) {
+            log::warn("{}: Could not update timeline1", __FUNCTION__);
+            m_target = previousTarget;
+            m_offset = previousOffset;
+            return false;
+        }
+
+        TraceScope scope("FCFW::SwitchPlayback");
+        if (!APIs::FCFW->SwitchPlayback(SKSE::GetPluginHandle(), activeTimelineID, m_transitionToTarget_TimelineID)) {
+            log::warn("{}: Could not switch playback", __FUNCTION__);
+            m_target = previousTarget;
+            m_offset = previousOffset;
+            return false;
+        }
+
+        // the at-target timeline is no longer playing and can be rebuilt for the new target
+        if (!UpdateTimeline2()) {
+            log::warn("{}: Could not update timeline2", __FUNCTION__);
+        }
+        ArmHandoff();
+
+        DispatchEffectMessage(SecondSight_API::SecondSightMessage::kTargetChanged);
+
+        return true;
+    }
+
     float FreeCameraManager::ComputeTransitionTime(RE::NiPoint3 a_targetPos) {
-        if (!m_target) {
+        if (!GetTarget()) {
             log::warn("{}: No target to compute transition time to", __FUNCTION__);
             return 1.0f;
         }
 
-        float minDistance = 2000.f;
-        float maxDistance = 10000.f;
-        float minTime = 0.5f;
-        float maxTime = 2.0f;
-
         float distance = _ts_SKSEFunctions::GetCameraPos().GetDistance(a_targetPos);
 
-        float relDistance = (distance - minDistance) / (maxDistance - minDistance);
-        relDistance = std::clamp(relDistance, 0.0f, 1.0f);
-        
-        float transitionTime = minTime + (maxTime - minTime) * relDistance;
-
-        return transitionTime;
+        // long range flights keep scaling with the distance instead of saturating
+        return m_transitionTiming.Compute(distance, m_isLongRangeEnabled ? m_longRangeSpeed : 0.f);
     }
 } // namespace SecondSight
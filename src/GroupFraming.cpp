@@ -0,0 +1,167 @@
+#include "GroupFraming.h"
+
+namespace SecondSight {
+    void GroupFraming::Clear() {
+        m_count = 0;
+        m_moments = Moments();
+    }
+
+    void GroupFraming::Rebuild() {
+        m_moments = Moments();
+        if (m_count == 0) {
+            return;
+        }
+
+        m_origin = CameraMath::Vec3(m_x[0], m_y[0], m_z[0]);
+        for (size_t i = 0; i < m_count; ++i) {
+            Accumulate(m_x[i], m_y[i], m_z[i], 1.0);
+        }
+    }
+
+    size_t GroupFraming::AddPoint(const CameraMath::Vec3& a_point) {
+        if (m_count >= kMaxPoints) {
+            return kMaxPoints;
+        }
+
+        if (m_count == 0) {
+            m_origin = a_point;
+            m_moments = Moments();
+        }
+
+        size_t index = m_count++;
+        m_x[index] = a_point.X();
+        m_y[index] = a_point.Y();
+        m_z[index] = a_point.Z();
+        Accumulate(m_x[index], m_y[index], m_z[index], 1.0);
+        FillPadding();
+
+        return index;
+    }
+
+    void GroupFraming::SetPoint(size_t a_index, const CameraMath::Vec3& a_point) {
+        if (a_index >= m_count) {
+            return;
+        }
+
+        float x = a_point.X();
+        float y = a_point.Y();
+        float z = a_point.Z();
+        if (m_x[a_index] == x && m_y[a_index] == y && m_z[a_index] == z) {
+            return;
+        }
+
+        Accumulate(m_x[a_index], m_y[a_index], m_z[a_index], -1.0);
+        m_x[a_index] = x;
+        m_y[a_index] = y;
+        m_z[a_index] = z;
+        Accumulate(x, y, z, 1.0);
+
+        if (a_index == 0) {
+            FillPadding();
+        }
+    }
+
+    void GroupFraming::RemovePoint(size_t a_index) {
+        if (a_index >= m_count) {
+            return;
+        }
+
+        Accumulate(m_x[a_index], m_y[a_index], m_z[a_index], -1.0);
+        --m_count;
+        m_x[a_index] = m_x[m_count];
+        m_y[a_index] = m_y[m_count];
+        m_z[a_index] = m_z[m_count];
+        FillPadding();
+    }
+
+    GroupFraming::Bounds GroupFraming::Compute() {
+        Bounds bounds;
+        bounds.count = m_count;
+        bounds.axis = m_axis;
+        if (m_count == 0) {
+            return bounds;
+        }
+
+        const double n = static_cast<double>(m_count);
+        const double cx = m_moments.x / n;
+        const double cy = m_moments.y / n;
+        const double cz = m_moments.z / n;
+        bounds.center = m_origin + CameraMath::Vec3(static_cast<float>(cx), static_cast<float>(cy), static_cast<float>(cz));
+
+        // radius: max distance from the centroid, four points per iteration. Padding lanes repeat
+        // point 0, so they never raise the maximum.
+        const __m128 centerX = _mm_set1_ps(bounds.center.X());
+        const __m128 centerY = _mm_set1_ps(bounds.center.Y());
+        const __m128 centerZ = _mm_set1_ps(bounds.center.Z());
+        __m128 maxDistSq = _mm_setzero_ps();
+        for (size_t i = 0; i < m_count; i += 4) {
+            __m128 dx = _mm_sub_ps(_mm_load_ps(&m_x[i]), centerX);
+            __m128 dy = _mm_sub_ps(_mm_load_ps(&m_y[i]), centerY);
+            __m128 dz = _mm_sub_ps(_mm_load_ps(&m_z[i]), centerZ);
+            __m128 distSq = _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, dx), _mm_mul_ps(dy, dy)), _mm_mul_ps(dz, dz));
+            maxDistSq = _mm_max_ps(maxDistSq, distSq);
+        }
+        maxDistSq = _mm_max_ps(maxDistSq, _mm_shuffle_ps(maxDistSq, maxDistSq, _MM_SHUFFLE(2, 3, 0, 1)));
+        maxDistSq = _mm_max_ps(maxDistSq, _mm_shuffle_ps(maxDistSq, maxDistSq, _MM_SHUFFLE(1, 0, 3, 2)));
+        bounds.radius = std::sqrt(_mm_cvtss_f32(maxDistSq));
+
+        if (m_count < 2) {
+            return bounds;
+        }
+
+        // covariance from the raw moments
+        const double sxx = m_moments.xx / n - cx * cx;
+        const double sxy = m_moments.xy / n - cx * cy;
+        const double sxz = m_moments.xz / n - cx * cz;
+        const double syy = m_moments.yy / n - cy * cy;
+        const double syz = m_moments.yz / n - cy * cz;
+        const double szz = m_moments.zz / n - cz * cz;
+
+        double ax = m_axis.X();
+        double ay = m_axis.Y();
+        double az = m_axis.Z();
+        for (size_t iteration = 0; iteration < kPowerIterations; ++iteration) {
+            double nx = sxx * ax + sxy * ay + sxz * az;
+            double ny = sxy * ax + syy * ay + syz * az;
+            double nz = sxz * ax + syz * ay + szz * az;
+            double length = std::sqrt(nx * nx + ny * ny + nz * nz);
+            if (length < 1e-9) {
+                // no spread along the previous axis, keep it
+                return bounds;
+            }
+            ax = nx / length;
+            ay = ny / length;
+            az = nz / length;
+        }
+
+        m_axis = CameraMath::Vec3(static_cast<float>(ax), static_cast<float>(ay), static_cast<float>(az));
+        bounds.axis = m_axis;
+        return bounds;
+    }
+
+    void GroupFraming::Accumulate(float a_x, float a_y, float a_z, double a_sign) {
+        const double x = static_cast<double>(a_x) - m_origin.X();
+        const double y = static_cast<double>(a_y) - m_origin.Y();
+        const double z = static_cast<double>(a_z) - m_origin.Z();
+        m_moments.x += a_sign * x;
+        m_moments.y += a_sign * y;
+        m_moments.z += a_sign * z;
+        m_moments.xx += a_sign * x * x;
+        m_moments.xy += a_sign * x * y;
+        m_moments.xz += a_sign * x * z;
+        m_moments.yy += a_sign * y * y;
+        m_moments.yz += a_sign * y * z;
+        m_moments.zz += a_sign * z * z;
+    }
+
+    void GroupFraming::FillPadding() {
+        if (m_count == 0) {
+            return;
+        }
+        for (size_t i = m_count; i < ((m_count + 3) & ~size_t(3)); ++i) {
+            m_x[i] = m_x[0];
+            m_y[i] = m_y[0];
+            m_z[i] = m_z[0];
+        }
+    }
+} // namespace SecondSight
@@ -1,6 +1,12 @@
 #include "Hooks.h"
 #include "_ts_SKSEFunctions.h"
 #include "FreeCameraManager.h"
+#include "QualityGovernor.h"
+#include "AllocationTracker.h"
+#include "ActorGrid.h"
+#include "AutoDirector.h"
+#include "NativeCameraDriver.h"
+#include "RewindRecorder.h"
 
 namespace Hooks
 {
@@ -9,6 +15,7 @@ namespace Hooks
 		log::info("Hooking...");
 
 		FreeCameraStateHook::Hook();
+		PlayerCharacterHook::Hook();
 
 		log::info("...success");
 	}
@@ -18,6 +25,21 @@ namespace Hooks
 
 		_Update(a_this, a_nextState);
 
+		SecondSight::AllocationScope allocations(SecondSight::AllocationTracker::Scope::kFrame);
+		// no-op unless the built-in camera driver is playing a timeline
+		SecondSight::NativeCameraDriver::GetSingleton().Update(a_this);
 		SecondSight::FreeCameraManager::GetSingleton().Update();
 	}
+
+	void PlayerCharacterHook::Update(RE::PlayerCharacter* a_this, float a_delta)
+	{
+		_Update(a_this, a_delta);
+
+		SecondSight::QualityGovernor::GetSingleton().OnFrame();
+		SecondSight::ActorGrid::GetSingleton().Sync();
+		SecondSight::FreeCameraManager::GetSingleton().UpdatePrewarm(a_delta);
+		SecondSight::AutoDirector::GetSingleton().Update(a_delta);
+		SecondSight::RewindRecorder::GetSingleton().Update(a_delta);
+		SecondSight::FreeCameraManager::GetSingleton().PublishSnapshot(a_delta);
+	}
 } // namespace Hooks
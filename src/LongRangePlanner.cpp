@@ -0,0 +1,52 @@
+#include "LongRangePlanner.h"
+
+namespace SecondSight::LongRange {
+    size_t Plan::GetStage(float a_elapsed) const {
+        for (size_t i = 0; i < stageCount; ++i) {
+            if (a_elapsed < stages[i].endTime) {
+                return i;
+            }
+        }
+        return stageCount > 0 ? stageCount - 1 : 0;
+    }
+
+    Plan BuildPlan(const CameraMath::Vec3& a_from, const CameraMath::Vec3& a_to, float a_duration, const Settings& a_settings) {
+        Plan plan;
+        plan.duration = a_duration;
+
+        float distance = CameraMath::Length(a_to - a_from);
+        float stageLength = std::max(a_settings.stageLength, 1.f);
+        plan.stageCount = std::clamp(static_cast<size_t>(std::ceil(distance / stageLength)), size_t(1), kMaxStages);
+
+        float arcHeight = std::min(distance * a_settings.arcHeightRatio, a_settings.maxArcHeight);
+
+        // waypoints on a sine arc above the straight line, the last one is the destination itself
+        std::array<float, kMaxStages> stageLengths{};
+        float totalLength = 0.f;
+        CameraMath::Vec3 previous = a_from;
+        for (size_t i = 0; i < plan.stageCount; ++i) {
+            float t = static_cast<float>(i + 1) / static_cast<float>(plan.stageCount);
+            CameraMath::Vec3 point = CameraMath::Lerp(a_from, a_to, t);
+            if (i + 1 < plan.stageCount) {
+                point = point + CameraMath::Vec3(0.f, 0.f, arcHeight * std::sin(CameraMath::kPi * t));
+            } else {
+                point = a_to;
+            }
+            plan.stages[i].end = point;
+            stageLengths[i] = CameraMath::Length(point - previous);
+            totalLength += stageLengths[i];
+            previous = point;
+        }
+
+        float time = 0.f;
+        for (size_t i = 0; i < plan.stageCount; ++i) {
+            float share = totalLength > 0.f ? stageLengths[i] / totalLength : 1.f / static_cast<float>(plan.stageCount);
+            plan.stages[i].startTime = time;
+            time += share * a_duration;
+            plan.stages[i].endTime = time;
+        }
+        plan.stages[plan.stageCount - 1].endTime = a_duration;
+
+        return plan;
+    }
+} // namespace SecondSight::LongRange
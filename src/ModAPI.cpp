@@ -0,0 +1,39 @@
+#include "ModAPI.h"
+#include "FreeCameraManager.h"
+#include "QualityGovernor.h"
+
+Messaging::SecondSightInterface::SecondSightInterface() noexcept {
+    apiTID = GetCurrentThreadId();
+}
+
+unsigned long Messaging::SecondSightInterface::GetSecondSightThreadId() const noexcept {
+    return apiTID;
+}
+
+int Messaging::SecondSightInterface::GetSecondSightPluginVersion() const noexcept {
+    return static_cast<int>(Plugin::VERSION.major() * 10000 + Plugin::VERSION.minor() * 100 + Plugin::VERSION.patch());
+}
+
+bool Messaging::SecondSightInterface::StartEffect() const noexcept {
+    return SecondSight::FreeCameraManager::GetSingleton().StartSecondSightEffect(SecondSight::CastQueue::Source::kAPI);
+}
+
+void Messaging::SecondSightInterface::StopEffect() const noexcept {
+    SecondSight::FreeCameraManager::GetSingleton().StopSecondSightEffect();
+}
+
+void Messaging::SecondSightInterface::SetTarget(RE::Actor* a_target) const noexcept {
+    SecondSight::FreeCameraManager::GetSingleton().SetExplicitTarget(a_target);
+}
+
+RE::Actor* Messaging::SecondSightInterface::GetTarget() const noexcept {
+    return SecondSight::FreeCameraManager::GetSingleton().GetEffectTarget();
+}
+
+SecondSight_API::EffectState Messaging::SecondSightInterface::GetEffectState() const noexcept {
+    return SecondSight::FreeCameraManager::GetSingleton().GetEffectState();
+}
+
+SecondSight_API::QualityTier Messaging::SecondSightInterface::GetQualityTier() const noexcept {
+    return SecondSight::QualityGovernor::GetSingleton().GetTier();
+}
@@ -0,0 +1,464 @@
+#include "NativeCameraDriver.h"
+#include "_ts_SKSEFunctions.h"
+#include "FreeCameraManager.h"
+
+namespace SecondSight {
+    using CameraMath::Vec3;
+
+    NativeCameraDriver::NativeCameraDriver() {
+        m_threadID = GetCurrentThreadId();
+    }
+
+    void NativeCameraDriver::Update(RE::FreeCameraState* a_state) {
+        if (!a_state || m_playback.clock.timelineID == 0) {
+            return;
+        }
+
+        auto it = m_timelines.find(m_playback.clock.timelineID);
+        if (it == m_timelines.end()) {
+            m_playback = Playback();
+            return;
+        }
+        auto timelineID = m_playback.clock.timelineID;
+
+        float duration = it->second.GetDuration();
+        auto event = m_playback.clock.Advance(RE::GetSecondsSinceLastFrame(), duration, it->second.playbackMode, it->second.loopTimeOffset);
+        if (event == PlaybackClock::Event::kSwitched) {
+            // the armed timeline takes over in this frame, its camera-anchored points start at the end pose
+            auto& finished = it->second;
+            Vec3 position = Vec3::From(a_state->translation);
+            if (finished.translation.GetCount() > 0) {
+                ResolveTranslation(finished);
+                position = finished.translation.Evaluate(duration);
+            }
+            Vec3 rotation(a_state->rotation.x, a_state->rotation.y, 0.f);
+            if (finished.rotation.GetCount() > 0) {
+                ResolveRotation(finished, position);
+                rotation = finished.rotation.Evaluate(duration) + m_playback.userRotation;
+            }
+            m_playback.cameraPosition = position;
+            m_playback.cameraRotation = rotation;
+            auto clock = m_playback.clock;
+            BeginTimeline(clock);
+
+            it = m_timelines.find(m_playback.clock.timelineID);
+            if (it == m_timelines.end()) {
+                m_playback = Playback();
+                return;
+            }
+            duration = it->second.GetDuration();
+        }
+        auto& timeline = it->second;
+
+        float time = m_playback.clock.time;
+        if ((m_playback.globalEaseIn || m_playback.globalEaseOut) && duration > 0.f) {
+            time = CameraTrack::Ease(time / duration, m_playback.globalEaseIn, m_playback.globalEaseOut) * duration;
+        }
+
+        Vec3 position = Vec3::From(a_state->translation);
+        if (timeline.translation.GetCount() > 0) {
+            ResolveTranslation(timeline);
+            position = timeline.translation.Evaluate(time);
+        }
+
+        Vec3 rotation(a_state->rotation.x, a_state->rotation.y, 0.f);
+        if (timeline.allowUserRotation && m_playback.hasWritten) {
+            // the original update applied this frame's look input on top of what was written last frame
+            float deltas[2] = { rotation.X() - m_playback.writtenRotation.X(), rotation.Y() - m_playback.writtenRotation.Y() };
+            CameraMath::NormalizeAngles(deltas, 2);
+            m_playback.userRotation = m_playback.userRotation + Vec3(deltas[0], deltas[1], 0.f);
+        }
+        if (timeline.rotation.GetCount() > 0) {
+            ResolveRotation(timeline, position);
+            rotation = timeline.rotation.Evaluate(time) + m_playback.userRotation;
+        }
+
+        a_state->translation = position.To<RE::NiPoint3>();
+        a_state->rotation.x = std::clamp(rotation.X(), -CameraMath::kPi / 2.f, CameraMath::kPi / 2.f);
+        a_state->rotation.y = CameraMath::NormalizeAngle(rotation.Y());
+        m_playback.writtenRotation = Vec3(a_state->rotation.x, a_state->rotation.y, 0.f);
+        m_playback.hasWritten = true;
+
+        // events last, the handler may switch or stop the playback
+        if (event == PlaybackClock::Event::kFinished && !m_playback.isStopPending) {
+            // leaving the free camera is deferred until the camera state update has returned
+            m_playback.isStopPending = true;
+            SKSE::GetTaskInterface()->AddTask([owner = timeline.owner, timelineID]() {
+                (void)GetSingleton().StopPlayback(owner, timelineID);
+            });
+        } else if (event == PlaybackClock::Event::kWaitReached || event == PlaybackClock::Event::kSwitched) {
+            Dispatch(FCFW_API::FCFWMessage::kPlaybackWait, timelineID);
+        }
+    }
+
+    bool NativeCameraDriver::ArmSwitch(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const {
+        if (!IsPlaybackRunning(a_pluginHandle, a_fromTimelineID) || !GetTimeline(a_pluginHandle, a_toTimelineID)) {
+            return false;
+        }
+        return m_playback.clock.Arm(a_toTimelineID);
+    }
+
+    unsigned long NativeCameraDriver::GetFCFWThreadId() const noexcept {
+        return m_threadID;
+    }
+
+    int NativeCameraDriver::GetFCFWPluginVersion() const noexcept {
+        return static_cast<int>(Plugin::VERSION.major() * 10000 + Plugin::VERSION.minor() * 100 + Plugin::VERSION.patch());
+    }
+
+    bool NativeCameraDriver::RegisterPlugin(SKSE::PluginHandle a_pluginHandle) const noexcept {
+        log::info("{}: Using the built-in camera driver for plugin {}", __FUNCTION__, a_pluginHandle);
+        return true;
+    }
+
+    size_t NativeCameraDriver::RegisterTimeline(SKSE::PluginHandle a_pluginHandle) const noexcept {
+        auto id = m_nextTimelineID++;
+        m_timelines[id].owner = a_pluginHandle;
+        return id;
+    }
+
+    bool NativeCameraDriver::UnregisterTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        if (!GetTimeline(a_pluginHandle, a_timelineID)) {
+            return false;
+        }
+        if (m_playback.clock.timelineID == a_timelineID) {
+            (void)StopPlayback(a_pluginHandle, a_timelineID);
+        } else if (m_playback.clock.armedTimelineID == a_timelineID) {
+            m_playback.clock.armedTimelineID = 0;
+        }
+        m_timelines.erase(a_timelineID);
+        return true;
+    }
+
+    int NativeCameraDriver::AddTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::NiPoint3& a_position, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        CameraTrack::Key key{ a_time, Vec3::From(a_position), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, false, key, PointSource());
+    }
+
+    int NativeCameraDriver::AddTranslationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::NiPoint3& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        if (!a_reference) {
+            return -1;
+        }
+        PointSource source{ PointSource::Kind::kReference, a_reference->GetHandle(), Vec3::From(a_offset), a_isOffsetRelative };
+        CameraTrack::Key key{ a_time, Vec3::From(a_reference->GetPosition() + a_offset), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, false, key, source);
+    }
+
+    int NativeCameraDriver::AddTranslationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        PointSource source;
+        source.kind = PointSource::Kind::kCamera;
+        CameraTrack::Key key{ a_time, Vec3::From(_ts_SKSEFunctions::GetCameraPos()), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, false, key, source);
+    }
+
+    int NativeCameraDriver::AddRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, const RE::BSTPoint2<float>& a_rotation, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        CameraTrack::Key key{ a_time, Vec3(a_rotation.x, a_rotation.y, 0.f), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, true, key, PointSource());
+    }
+
+    int NativeCameraDriver::AddRotationPointAtRef(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, RE::TESObjectREFR* a_reference, const RE::BSTPoint2<float>& a_offset, bool a_isOffsetRelative, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        if (!a_reference) {
+            return -1;
+        }
+        PointSource source{ PointSource::Kind::kReference, a_reference->GetHandle(), Vec3(a_offset.x, a_offset.y, 0.f), a_isOffsetRelative };
+        CameraTrack::Key key{ a_time, Vec3(a_offset.x, a_offset.y, 0.f), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, true, key, source);
+    }
+
+    int NativeCameraDriver::AddRotationPointAtCamera(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_time, bool a_easeIn, bool a_easeOut, int a_interpolationMode) const noexcept {
+        PointSource source;
+        source.kind = PointSource::Kind::kCamera;
+        auto rotation = _ts_SKSEFunctions::GetCameraRotation();
+        CameraTrack::Key key{ a_time, Vec3(rotation.x, rotation.z, 0.f), a_easeIn, a_easeOut, ToInterpolation(a_interpolationMode) };
+        return AddPoint(a_pluginHandle, a_timelineID, true, key, source);
+    }
+
+    bool NativeCameraDriver::RemoveTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || !timeline->translation.Remove(a_index)) {
+            return false;
+        }
+        timeline->translationSources.erase(timeline->translationSources.begin() + a_index);
+        return true;
+    }
+
+    bool NativeCameraDriver::RemoveRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || !timeline->rotation.Remove(a_index)) {
+            return false;
+        }
+        timeline->rotationSources.erase(timeline->rotationSources.begin() + a_index);
+        return true;
+    }
+
+    bool NativeCameraDriver::StartRecording(SKSE::PluginHandle, size_t, float, bool, float) const noexcept {
+        log::warn("{}: Recording is not supported by the built-in camera driver", __FUNCTION__);
+        return false;
+    }
+
+    bool NativeCameraDriver::StopRecording(SKSE::PluginHandle, size_t) const noexcept {
+        return false;
+    }
+
+    bool NativeCameraDriver::ClearTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || m_playback.clock.timelineID == a_timelineID) {
+            return false;
+        }
+        timeline->translation.Clear();
+        timeline->rotation.Clear();
+        timeline->translationSources.clear();
+        timeline->rotationSources.clear();
+        return true;
+    }
+
+    int NativeCameraDriver::GetTranslationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        return timeline ? static_cast<int>(timeline->translation.GetCount()) : -1;
+    }
+
+    int NativeCameraDriver::GetRotationPointCount(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        return timeline ? static_cast<int>(timeline->rotation.GetCount()) : -1;
+    }
+
+    RE::NiPoint3 NativeCameraDriver::GetTranslationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || a_index >= timeline->translation.GetCount()) {
+            return RE::NiPoint3();
+        }
+        return timeline->translation.GetKey(a_index).value.To<RE::NiPoint3>();
+    }
+
+    RE::BSTPoint2<float> NativeCameraDriver::GetRotationPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, size_t a_index) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || a_index >= timeline->rotation.GetCount()) {
+            return RE::BSTPoint2<float>();
+        }
+        auto& value = timeline->rotation.GetKey(a_index).value;
+        return RE::BSTPoint2<float>{ value.X(), value.Y() };
+    }
+
+    bool NativeCameraDriver::StartPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, float a_speed, bool a_globalEaseIn, bool a_globalEaseOut, bool a_useDuration, float a_duration, bool /*a_followGround*/, float /*a_minHeightAboveGround*/, bool /*a_showMenusDuringPlayback*/) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || m_playback.clock.timelineID != 0) {
+            return false;
+        }
+        if (timeline->translation.GetCount() == 0 && timeline->rotation.GetCount() == 0) {
+            log::warn("{}: Timeline {} has no points", __FUNCTION__, a_timelineID);
+            return false;
+        }
+
+        auto* playerCamera = RE::PlayerCamera::GetSingleton();
+        if (!playerCamera || !playerCamera->currentState) {
+            return false;
+        }
+
+        CaptureCamera();
+        if (playerCamera->currentState->id != RE::CameraState::kFree) {
+            playerCamera->ToggleFreeCameraMode(false);
+        }
+
+        float duration = timeline->GetDuration();
+        PlaybackClock clock;
+        clock.timelineID = a_timelineID;
+        clock.speed = a_useDuration ? (a_duration > 0.f ? duration / a_duration : 0.f) : std::max(a_speed, 0.f);
+        BeginTimeline(clock);
+        m_playback.globalEaseIn = a_globalEaseIn;
+        m_playback.globalEaseOut = a_globalEaseOut;
+
+        Dispatch(FCFW_API::FCFWMessage::kPlaybackStart, a_timelineID);
+        return true;
+    }
+
+    bool NativeCameraDriver::StopPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        if (!GetTimeline(a_pluginHandle, a_timelineID) || m_playback.clock.timelineID != a_timelineID) {
+            return false;
+        }
+        m_playback = Playback();
+
+        auto* playerCamera = RE::PlayerCamera::GetSingleton();
+        if (playerCamera && playerCamera->currentState && playerCamera->currentState->id == RE::CameraState::kFree) {
+            playerCamera->ToggleFreeCameraMode(false);
+        }
+
+        Dispatch(FCFW_API::FCFWMessage::kPlaybackStop, a_timelineID);
+        return true;
+    }
+
+    bool NativeCameraDriver::SwitchPlayback(SKSE::PluginHandle a_pluginHandle, size_t a_fromTimelineID, size_t a_toTimelineID) const noexcept {
+        if (m_playback.clock.timelineID == 0 || !GetTimeline(a_pluginHandle, a_toTimelineID)) {
+            return false;
+        }
+        if (a_fromTimelineID != 0 ? m_playback.clock.timelineID != a_fromTimelineID : !GetTimeline(a_pluginHandle, m_playback.clock.timelineID)) {
+            return false;
+        }
+
+        // camera-anchored points of the new timeline start where the camera is now
+        CaptureCamera();
+        auto clock = m_playback.clock;
+        clock.Switch(a_toTimelineID);
+        BeginTimeline(clock);
+        return true;
+    }
+
+    bool NativeCameraDriver::PausePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        if (!GetTimeline(a_pluginHandle, a_timelineID) || m_playback.clock.timelineID != a_timelineID) {
+            return false;
+        }
+        m_playback.clock.isPaused = true;
+        return true;
+    }
+
+    bool NativeCameraDriver::ResumePlayback(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        if (!GetTimeline(a_pluginHandle, a_timelineID) || m_playback.clock.timelineID != a_timelineID) {
+            return false;
+        }
+        m_playback.clock.isPaused = false;
+        return true;
+    }
+
+    bool NativeCameraDriver::IsPlaybackRunning(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return a_timelineID != 0 && m_playback.clock.timelineID == a_timelineID && GetTimeline(a_pluginHandle, a_timelineID);
+    }
+
+    bool NativeCameraDriver::IsRecording(SKSE::PluginHandle, size_t) const noexcept {
+        return false;
+    }
+
+    bool NativeCameraDriver::IsPlaybackPaused(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        return IsPlaybackRunning(a_pluginHandle, a_timelineID) && m_playback.clock.isPaused;
+    }
+
+    size_t NativeCameraDriver::GetActiveTimelineID() const noexcept {
+        return m_playback.clock.timelineID;
+    }
+
+    void NativeCameraDriver::AllowUserRotation(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_allow) const noexcept {
+        if (auto* timeline = GetTimeline(a_pluginHandle, a_timelineID)) {
+            timeline->allowUserRotation = a_allow;
+        }
+    }
+
+    bool NativeCameraDriver::IsUserRotationAllowed(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        return timeline && timeline->allowUserRotation;
+    }
+
+    bool NativeCameraDriver::SetPlaybackMode(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, int a_playbackMode, float a_loopTimeOffset) const noexcept {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || a_playbackMode < 0 || a_playbackMode > static_cast<int>(PlaybackMode::kWait)) {
+            return false;
+        }
+        timeline->playbackMode = static_cast<PlaybackMode>(a_playbackMode);
+        timeline->loopTimeOffset = std::max(a_loopTimeOffset, 0.f);
+        return true;
+    }
+
+    bool NativeCameraDriver::AddTimelineFromFile(SKSE::PluginHandle, size_t, const char* a_filePath, float) const noexcept {
+        log::warn("{}: Timeline files are not supported by the built-in camera driver ({})", __FUNCTION__, a_filePath ? a_filePath : "");
+        return false;
+    }
+
+    bool NativeCameraDriver::ExportTimeline(SKSE::PluginHandle, size_t, const char* a_filePath) const noexcept {
+        log::warn("{}: Timeline files are not supported by the built-in camera driver ({})", __FUNCTION__, a_filePath ? a_filePath : "");
+        return false;
+    }
+
+    NativeCameraDriver::Timeline* NativeCameraDriver::GetTimeline(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID) const {
+        auto it = m_timelines.find(a_timelineID);
+        if (it == m_timelines.end() || it->second.owner != a_pluginHandle) {
+            return nullptr;
+        }
+        return &it->second;
+    }
+
+    int NativeCameraDriver::AddPoint(SKSE::PluginHandle a_pluginHandle, size_t a_timelineID, bool a_isRotation, const CameraTrack::Key& a_key, const PointSource& a_source) const {
+        auto* timeline = GetTimeline(a_pluginHandle, a_timelineID);
+        if (!timeline || !(a_key.time >= 0.f)) {
+            return -1;
+        }
+        auto& track = a_isRotation ? timeline->rotation : timeline->translation;
+        auto& sources = a_isRotation ? timeline->rotationSources : timeline->translationSources;
+        auto index = track.Add(a_key);
+        sources.insert(sources.begin() + index, a_source);
+        return static_cast<int>(index);
+    }
+
+    void NativeCameraDriver::BeginTimeline(const PlaybackClock& a_clock) const {
+        auto cameraPosition = m_playback.cameraPosition;
+        auto cameraRotation = m_playback.cameraRotation;
+        m_playback = Playback();
+        m_playback.clock = a_clock;
+        m_playback.cameraPosition = cameraPosition;
+        m_playback.cameraRotation = cameraRotation;
+    }
+
+    void NativeCameraDriver::CaptureCamera() const {
+        auto rotation = _ts_SKSEFunctions::GetCameraRotation();
+        m_playback.cameraPosition = Vec3::From(_ts_SKSEFunctions::GetCameraPos());
+        m_playback.cameraRotation = Vec3(rotation.x, rotation.z, 0.f);
+    }
+
+    void NativeCameraDriver::ResolveTranslation(Timeline& a_timeline) const {
+        for (size_t i = 0; i < a_timeline.translationSources.size(); ++i) {
+            auto& source = a_timeline.translationSources[i];
+            switch (source.kind) {
+            case PointSource::Kind::kCamera:
+                a_timeline.translation.SetValue(i, m_playback.cameraPosition);
+                break;
+            case PointSource::Kind::kReference:
+                if (auto reference = source.reference.get()) {
+                    Vec3 offset = source.offset;
+                    if (source.isOffsetRelative) {
+                        // x = right, y = forward, z = up relative to the reference's heading
+                        float heading = reference->GetAngleZ();
+                        float s = std::sin(heading), c = std::cos(heading);
+                        offset = Vec3(offset.X() * c + offset.Y() * s, -offset.X() * s + offset.Y() * c, offset.Z());
+                    }
+                    a_timeline.translation.SetValue(i, Vec3::From(reference->GetPosition()) + offset);
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void NativeCameraDriver::ResolveRotation(Timeline& a_timeline, const Vec3& a_cameraPosition) const {
+        for (size_t i = 0; i < a_timeline.rotationSources.size(); ++i) {
+            auto& source = a_timeline.rotationSources[i];
+            switch (source.kind) {
+            case PointSource::Kind::kCamera:
+                a_timeline.rotation.SetValue(i, m_playback.cameraRotation);
+                break;
+            case PointSource::Kind::kReference:
+                if (auto reference = source.reference.get()) {
+                    CameraMath::PitchYaw base;
+                    if (source.isOffsetRelative) {
+                        base.yaw = reference->GetAngleZ();
+                    } else {
+                        auto* actor = reference->As<RE::Actor>();
+                        auto lookAt = actor ? actor->GetLookingAtLocation() : reference->GetPosition();
+                        base = CameraMath::LookAt(a_cameraPosition, Vec3::From(lookAt), m_playback.cameraRotation.Y());
+                    }
+                    a_timeline.rotation.SetValue(i, Vec3(base.pitch + source.offset.X(), base.yaw + source.offset.Y(), 0.f));
+                }
+                break;
+            default:
+                break;
+            }
+        }
+    }
+
+    void NativeCameraDriver::Dispatch(FCFW_API::FCFWMessage a_message, size_t a_timelineID) {
+        FCFW_API::FCFWTimelineEventData data{ a_timelineID };
+        SKSE::MessagingInterface::Message message{ FCFW_API::FCFWPluginName, static_cast<std::uint32_t>(a_message),
+            static_cast<std::uint32_t>(sizeof(data)), &data };
+        FreeCameraManager::FCFWMessageHandler(&message);
+    }
+
+    CameraTrack::Interpolation NativeCameraDriver::ToInterpolation(int a_mode) {
+        return static_cast<CameraTrack::Interpolation>(std::clamp(a_mode, 0, static_cast<int>(CameraTrack::Interpolation::kCubicHermite)));
+    }
+} // namespace SecondSight
@@ -0,0 +1,55 @@
+#include "PlaybackClock.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace SecondSight {
+    PlaybackClock::Event PlaybackClock::Advance(float a_delta, float a_duration, Mode a_mode, float a_loopTimeOffset) {
+        if (!isPaused && !isWaiting) {
+            time += a_delta * speed;
+        }
+        if (time < a_duration) {
+            return Event::kNone;
+        }
+
+        switch (a_mode) {
+        case Mode::kEnd:
+            time = a_duration;
+            return Event::kFinished;
+        case Mode::kLoop:
+            {
+                float loopStart = std::clamp(a_loopTimeOffset, 0.f, a_duration);
+                float loopLength = a_duration - loopStart;
+                time = loopLength > 0.f ? loopStart + std::fmod(time - a_duration, loopLength) : a_duration;
+            }
+            return Event::kNone;
+        case Mode::kWait:
+            if (isWaiting) {
+                return Event::kNone;
+            }
+            if (armedTimelineID != 0) {
+                // the successor plays the part of the frame beyond the end
+                time -= a_duration;
+                timelineID = armedTimelineID;
+                armedTimelineID = 0;
+                return Event::kSwitched;
+            }
+            time = a_duration;
+            isWaiting = true;
+            return Event::kWaitReached;
+        }
+        return Event::kNone;
+    }
+
+    void PlaybackClock::Switch(size_t a_timelineID) {
+        *this = PlaybackClock{ a_timelineID, 0.f, speed };
+    }
+
+    bool PlaybackClock::Arm(size_t a_timelineID) {
+        if (timelineID == 0 || isWaiting) {
+            return false;
+        }
+        armedTimelineID = a_timelineID;
+        return true;
+    }
+} // namespace SecondSight
@@ -0,0 +1,94 @@
+#include "QualityGovernor.h"
+#include "_ts_SKSEFunctions.h"
+#include "TraceRecorder.h"
+
+namespace SecondSight {
+    namespace {
+        const char* ToString(QualityGovernor::QualityTier a_tier) {
+            switch (a_tier) {
+            case QualityGovernor::QualityTier::kHigh:
+                return "High";
+            case QualityGovernor::QualityTier::kMedium:
+                return "Medium";
+            case QualityGovernor::QualityTier::kLow:
+                return "Low";
+            }
+            return "Unknown";
+        }
+    }
+
+    void QualityGovernor::LoadSettings() {
+        const char* iniFile = "SKSE/Plugins/SecondSight.ini";
+
+        long enabled = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "EnableQualityGovernor:Quality", iniFile, 1L);
+        float targetFrameTime = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "TargetFrameTimeMs:Quality", iniFile, 1000.f / 60.f);
+
+        m_isEnabled = enabled != 0;
+        m_targetFrameTime = std::max(targetFrameTime, 1.f) / 1000.f;
+        if (!m_isEnabled) {
+            m_tier = QualityTier::kHigh;
+        }
+
+        log::info("{}: Quality governor {}, target frame time {:.2f} ms", __FUNCTION__, m_isEnabled ? "enabled" : "disabled", m_targetFrameTime * 1000.f);
+    }
+
+    void QualityGovernor::OnFrame() {
+        if (!m_isEnabled) {
+            return;
+        }
+
+        auto now = std::chrono::steady_clock::now();
+        if (!m_hasLastFrame) {
+            m_lastFrame = now;
+            m_hasLastFrame = true;
+            return;
+        }
+        float frameTime = std::chrono::duration<float>(now - m_lastFrame).count();
+        m_lastFrame = now;
+
+        if (frameTime > kMaxFrameDelta || RE::UI::GetSingleton()->GameIsPaused()) {
+            return;
+        }
+
+        m_frameTimeSum += frameTime - m_frameTimes[m_frameIndex];
+        m_frameTimes[m_frameIndex] = frameTime;
+        m_frameIndex = (m_frameIndex + 1) % kWindowSize;
+        m_frameCount = std::min(m_frameCount + 1, kWindowSize);
+        m_holdTimer += frameTime;
+
+        if (m_frameCount < kWindowSize || m_holdTimer < kHoldTime) {
+            return;
+        }
+
+        float averageFrameTime = static_cast<float>(m_frameTimeSum / kWindowSize);
+        if (averageFrameTime > m_targetFrameTime * kDowngradeRatio && m_tier != QualityTier::kLow) {
+            SetTier(static_cast<QualityTier>(static_cast<std::uint8_t>(m_tier) + 1), averageFrameTime);
+        } else if (averageFrameTime < m_targetFrameTime * kUpgradeRatio && m_tier != QualityTier::kHigh) {
+            SetTier(static_cast<QualityTier>(static_cast<std::uint8_t>(m_tier) - 1), averageFrameTime);
+        }
+    }
+
+    float QualityGovernor::GetClampBlendRate(float a_baseRate) const {
+        return m_tier == QualityTier::kLow ? 0.f : a_baseRate;
+    }
+
+    float QualityGovernor::GetRescanInterval(float a_baseInterval) const {
+        switch (m_tier) {
+        case QualityTier::kMedium:
+            return 2.f * a_baseInterval;
+        case QualityTier::kLow:
+            return 4.f * a_baseInterval;
+        default:
+            return a_baseInterval;
+        }
+    }
+
+    void QualityGovernor::SetTier(QualityTier a_tier, float a_averageFrameTime) {
+        log::info("{}: Quality tier {} -> {} (average frame time {:.2f} ms, target {:.2f} ms)", __FUNCTION__,
+            ToString(m_tier), ToString(a_tier), a_averageFrameTime * 1000.f, m_targetFrameTime * 1000.f);
+        TraceRecorder::GetSingleton().Instant("QualityTierChanged", static_cast<std::uint64_t>(a_tier));
+
+        m_tier = a_tier;
+        m_holdTimer = 0.f;
+    }
+} // namespace SecondSight
@@ -0,0 +1,250 @@
+#include "RewindBuffer.h"
+
+#include <algorithm>
+#include <cmath>
+#include <numbers>
+
+namespace SecondSight {
+    namespace {
+        constexpr float kHeadingScale = 65536.f / (2.f * std::numbers::pi_v<float>);
+
+        std::uint64_t ZigZag(std::int64_t a_value) {
+            return (static_cast<std::uint64_t>(a_value) << 1) ^ static_cast<std::uint64_t>(a_value >> 63);
+        }
+
+        std::int64_t UnZigZag(std::uint64_t a_value) {
+            return static_cast<std::int64_t>(a_value >> 1) ^ -static_cast<std::int64_t>(a_value & 1);
+        }
+
+        size_t WriteVarint(std::uint64_t a_value, std::uint8_t* a_out) {
+            size_t size = 0;
+            while (a_value >= 0x80) {
+                a_out[size++] = static_cast<std::uint8_t>(a_value | 0x80);
+                a_value >>= 7;
+            }
+            a_out[size++] = static_cast<std::uint8_t>(a_value);
+            return size;
+        }
+
+        std::uint64_t ReadVarint(const std::uint8_t*& a_in) {
+            std::uint64_t value = 0;
+            for (int shift = 0;; shift += 7) {
+                std::uint8_t byte = *a_in++;
+                value |= static_cast<std::uint64_t>(byte & 0x7F) << shift;
+                if (!(byte & 0x80)) {
+                    return value;
+                }
+            }
+        }
+    }
+
+    RewindBuffer::RewindBuffer(const Settings& a_settings) :
+        m_settings(a_settings) {
+        m_settings.trackCount = std::max<size_t>(m_settings.trackCount, 1);
+        m_settings.blocksPerTrack = std::max<size_t>(m_settings.blocksPerTrack, 2);
+
+        m_ids.resize(m_settings.trackCount);
+        m_tracks.resize(m_settings.trackCount);
+        m_blocks.resize(m_settings.trackCount * m_settings.blocksPerTrack);
+        Clear();
+    }
+
+    void RewindBuffer::Clear() {
+        std::fill(m_ids.begin(), m_ids.end(), 0);
+        for (size_t i = 0; i < m_tracks.size(); ++i) {
+            m_tracks[i] = Track();
+            m_tracks[i].firstBlock = static_cast<std::uint32_t>(i * m_settings.blocksPerTrack);
+        }
+    }
+
+    RewindBuffer::Quantized RewindBuffer::Quantize(const Sample& a_sample) {
+        Quantized quantized;
+        quantized.time = std::llround(static_cast<double>(a_sample.time) * 1000.0);
+        quantized.x = static_cast<std::int32_t>(std::lround(a_sample.x / kPositionStep));
+        quantized.y = static_cast<std::int32_t>(std::lround(a_sample.y / kPositionStep));
+        quantized.z = static_cast<std::int32_t>(std::lround(a_sample.z / kPositionStep));
+        // wraps to [0, 65536) for any heading
+        quantized.heading = static_cast<std::uint16_t>(std::lround(a_sample.heading * kHeadingScale));
+        return quantized;
+    }
+
+    RewindBuffer::Sample RewindBuffer::Dequantize(const Quantized& a_quantized) {
+        Sample sample;
+        sample.time = static_cast<float>(a_quantized.time / 1000.0);
+        sample.x = a_quantized.x * kPositionStep;
+        sample.y = a_quantized.y * kPositionStep;
+        sample.z = a_quantized.z * kPositionStep;
+        sample.heading = a_quantized.heading / kHeadingScale;
+        return sample;
+    }
+
+    size_t RewindBuffer::FindTrack(TrackID a_id) const {
+        if (a_id == 0) {
+            return kNoTrack;
+        }
+        auto it = std::find(m_ids.begin(), m_ids.end(), a_id);
+        return it != m_ids.end() ? static_cast<size_t>(it - m_ids.begin()) : kNoTrack;
+    }
+
+    size_t RewindBuffer::ClaimTrack(TrackID a_id) {
+        // an unused track, or the one written least recently
+        size_t index = 0;
+        for (size_t i = 0; i < m_ids.size(); ++i) {
+            if (m_ids[i] == 0) {
+                index = i;
+                break;
+            }
+            if (m_tracks[i].lastWrite < m_tracks[index].lastWrite) {
+                index = i;
+            }
+        }
+
+        m_ids[index] = a_id;
+        auto& track = m_tracks[index];
+        track.head = 0;
+        track.blockCount = 0;
+        return index;
+    }
+
+    const RewindBuffer::Block& RewindBuffer::GetBlock(const Track& a_track, size_t a_age) const {
+        size_t slot = (a_track.head + m_settings.blocksPerTrack + 1 - a_track.blockCount + a_age) % m_settings.blocksPerTrack;
+        return m_blocks[a_track.firstBlock + slot];
+    }
+
+    void RewindBuffer::Record(TrackID a_id, const Sample& a_sample) {
+        if (a_id == 0) {
+            return;
+        }
+        size_t index = FindTrack(a_id);
+        if (index == kNoTrack) {
+            index = ClaimTrack(a_id);
+        }
+        auto& track = m_tracks[index];
+        auto quantized = Quantize(a_sample);
+
+        if (track.blockCount > 0) {
+            auto& block = m_blocks[track.firstBlock + track.head];
+            auto timeDelta = quantized.time - track.last.time;
+            if (timeDelta < 0) {
+                return;
+            }
+            if (block.count < kBlockSamples && block.size + kMaxSampleBytes <= kBlockBytes && timeDelta < (1 << 21)) {
+                auto* out = block.data.data() + block.size;
+                size_t size = WriteVarint(static_cast<std::uint64_t>(timeDelta), out);
+                size += WriteVarint(ZigZag(static_cast<std::int64_t>(quantized.x) - track.last.x), out + size);
+                size += WriteVarint(ZigZag(static_cast<std::int64_t>(quantized.y) - track.last.y), out + size);
+                size += WriteVarint(ZigZag(static_cast<std::int64_t>(quantized.z) - track.last.z), out + size);
+                size += WriteVarint(ZigZag(static_cast<std::int16_t>(quantized.heading - track.last.heading)), out + size);
+                block.size = static_cast<std::uint8_t>(block.size + size);
+                ++block.count;
+
+                track.last = quantized;
+                track.lastWrite = quantized.time;
+                return;
+            }
+            track.head = static_cast<std::uint32_t>((track.head + 1) % m_settings.blocksPerTrack);
+        }
+
+        // start a new block, overwriting the oldest one once the ring is full
+        auto& block = m_blocks[track.firstBlock + track.head];
+        block.key = quantized;
+        block.count = 1;
+        block.size = 0;
+        track.blockCount = static_cast<std::uint32_t>(std::min<size_t>(track.blockCount + 1, m_settings.blocksPerTrack));
+        track.last = quantized;
+        track.lastWrite = quantized.time;
+    }
+
+    void RewindBuffer::Remove(TrackID a_id) {
+        size_t index = FindTrack(a_id);
+        if (index == kNoTrack) {
+            return;
+        }
+        m_ids[index] = 0;
+        m_tracks[index].blockCount = 0;
+        m_tracks[index].lastWrite = 0;
+    }
+
+    bool RewindBuffer::GetTimeRange(TrackID a_id, float& a_oldest, float& a_newest) const {
+        size_t index = FindTrack(a_id);
+        if (index == kNoTrack || m_tracks[index].blockCount == 0) {
+            return false;
+        }
+        auto& track = m_tracks[index];
+        a_oldest = Dequantize(GetBlock(track, 0).key).time;
+        a_newest = Dequantize(track.last).time;
+        return true;
+    }
+
+    size_t RewindBuffer::Decode(TrackID a_id, float a_from, float a_to, std::vector<Sample>& a_out) const {
+        size_t index = FindTrack(a_id);
+        if (index == kNoTrack) {
+            return 0;
+        }
+        auto& track = m_tracks[index];
+        auto from = std::llround(static_cast<double>(a_from) * 1000.0);
+        auto to = std::llround(static_cast<double>(a_to) * 1000.0);
+
+        size_t appended = 0;
+        for (size_t age = 0; age < track.blockCount; ++age) {
+            auto& block = GetBlock(track, age);
+            if (block.key.time > to) {
+                break;
+            }
+            // the whole block is older than the range if the next one still starts before it
+            if (age + 1 < track.blockCount && GetBlock(track, age + 1).key.time < from) {
+                continue;
+            }
+
+            auto quantized = block.key;
+            const auto* in = block.data.data();
+            for (size_t i = 0; i < block.count; ++i) {
+                if (i > 0) {
+                    quantized.time += static_cast<std::int64_t>(ReadVarint(in));
+                    quantized.x += static_cast<std::int32_t>(UnZigZag(ReadVarint(in)));
+                    quantized.y += static_cast<std::int32_t>(UnZigZag(ReadVarint(in)));
+                    quantized.z += static_cast<std::int32_t>(UnZigZag(ReadVarint(in)));
+                    quantized.heading = static_cast<std::uint16_t>(quantized.heading + UnZigZag(ReadVarint(in)));
+                }
+                if (quantized.time > to) {
+                    return appended;
+                }
+                if (quantized.time >= from) {
+                    a_out.push_back(Dequantize(quantized));
+                    ++appended;
+                }
+            }
+        }
+        return appended;
+    }
+
+    size_t RewindBuffer::GetMemoryUsage() const {
+        return sizeof(*this) + m_ids.capacity() * sizeof(TrackID) + m_tracks.capacity() * sizeof(Track) + m_blocks.capacity() * sizeof(Block);
+    }
+
+    size_t RewindBuffer::GetEncodedBytes() const {
+        size_t bytes = 0;
+        for (size_t i = 0; i < m_tracks.size(); ++i) {
+            if (m_ids[i] == 0) {
+                continue;
+            }
+            for (size_t age = 0; age < m_tracks[i].blockCount; ++age) {
+                bytes += sizeof(Quantized) + GetBlock(m_tracks[i], age).size;
+            }
+        }
+        return bytes;
+    }
+
+    size_t RewindBuffer::GetSampleCount() const {
+        size_t count = 0;
+        for (size_t i = 0; i < m_tracks.size(); ++i) {
+            if (m_ids[i] == 0) {
+                continue;
+            }
+            for (size_t age = 0; age < m_tracks[i].blockCount; ++age) {
+                count += GetBlock(m_tracks[i], age).count;
+            }
+        }
+        return count;
+    }
+} // namespace SecondSight
@@ -0,0 +1,87 @@
+#include "RewindRecorder.h"
+#include "_ts_SKSEFunctions.h"
+#include "TraceRecorder.h"
+
+namespace SecondSight {
+    void RewindRecorder::LoadSettings() {
+        const char* iniFile = "SKSE/Plugins/SecondSight.ini";
+
+        m_isEnabled = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Enabled:Rewind", iniFile, 1.f) != 0.f;
+        m_sampleInterval = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "SampleInterval:Rewind", iniFile, m_sampleInterval);
+        m_sampleInterval = std::clamp(m_sampleInterval, 0.02f, 0.5f);
+        m_radius = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "Radius:Rewind", iniFile, m_radius);
+        m_radius = std::max(m_radius, 500.f);
+        m_maxSeconds = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "MaxSeconds:Rewind", iniFile, m_maxSeconds);
+        m_maxSeconds = std::clamp(m_maxSeconds, 1.f, 30.f);
+
+        // size the rings for the longest rewind, assuming blocks fill up after 3/4 of their samples
+        RewindBuffer::Settings settings;
+        auto samplesPerBlock = RewindBuffer::kBlockSamples * 3 / 4;
+        settings.blocksPerTrack = static_cast<size_t>(std::ceil(m_maxSeconds / m_sampleInterval / samplesPerBlock)) + 2;
+        m_buffer = RewindBuffer(settings);
+        m_time = 0.f;
+        m_sampleTimer = 0.f;
+
+        log::info("{}: Rewind {}, {:.2f} s interval, {:.0f} units radius, {:.1f} s history, {} bytes", __FUNCTION__,
+            m_isEnabled ? "enabled" : "disabled", m_sampleInterval, m_radius, m_maxSeconds, m_buffer.GetMemoryUsage());
+    }
+
+    void RewindRecorder::Clear() {
+        m_buffer.Clear();
+        m_time = 0.f;
+        m_sampleTimer = 0.f;
+    }
+
+    void RewindRecorder::Update(float a_delta) {
+        if (!m_isEnabled || a_delta <= 0.f) {
+            return;
+        }
+
+        m_time += a_delta;
+        m_sampleTimer += a_delta;
+        if (m_sampleTimer < m_sampleInterval) {
+            return;
+        }
+        m_sampleTimer = std::fmod(m_sampleTimer, m_sampleInterval);
+
+        TraceScope scope("RewindRecorder::Update");
+
+        auto* processLists = RE::ProcessLists::GetSingleton();
+        if (!processLists) {
+            return;
+        }
+        for (auto& handle : processLists->highActorHandles) {
+            if (auto actor = handle.get()) {
+                Sample(actor.get());
+            }
+        }
+        Sample(RE::PlayerCharacter::GetSingleton());
+    }
+
+    void RewindRecorder::Sample(RE::Actor* a_actor) {
+        if (!a_actor || !a_actor->Get3D2()) {
+            return;
+        }
+        auto* player = RE::PlayerCharacter::GetSingleton();
+        auto position = a_actor->GetPosition();
+        if (a_actor != player && position.GetSquaredDistance(player->GetPosition()) > m_radius * m_radius) {
+            return;
+        }
+
+        RewindBuffer::Sample sample;
+        sample.time = m_time;
+        sample.x = position.x;
+        sample.y = position.y;
+        sample.z = position.z;
+        sample.heading = a_actor->GetHeading(false);
+        m_buffer.Record(a_actor->GetFormID(), sample);
+    }
+
+    bool RewindRecorder::GetPath(const RE::Actor* a_actor, float a_seconds, std::vector<RewindBuffer::Sample>& a_out) const {
+        if (!a_actor) {
+            return false;
+        }
+        auto count = m_buffer.Decode(a_actor->GetFormID(), m_time - std::min(a_seconds, m_maxSeconds), m_time, a_out);
+        return count >= 2;
+    }
+} // namespace SecondSight
@@ -0,0 +1,206 @@
+#include "ScreenProjection.h"
+
+#include <algorithm>
+#include <bit>
+#include <cmath>
+
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#    include <intrin.h>
+#endif
+
+// MSVC emits AVX2 intrinsics without /arch:AVX2, GCC and Clang need the target attribute
+#if defined(__GNUC__) || defined(__clang__)
+#    define SECONDSIGHT_TARGET_AVX2 __attribute__((target("avx2,fma")))
+#else
+#    define SECONDSIGHT_TARGET_AVX2
+#endif
+
+namespace SecondSight::ScreenProjection {
+    namespace {
+        constexpr float kMinW = 1e-5f;          // NiCamera::WorldPtToScreenPt3 zero tolerance
+        constexpr float kMinDistance = 1.f;
+
+        void Append(Result& a_result, size_t a_index, float a_cosAngle, float a_distance, float a_screenX, float a_screenY) {
+            auto slot = a_result.count++;
+            a_result.indices[slot] = static_cast<std::uint32_t>(a_index);
+            a_result.cosAngle[slot] = a_cosAngle;
+            a_result.distance[slot] = a_distance;
+            a_result.screenX[slot] = a_screenX;
+            a_result.screenY[slot] = a_screenY;
+        }
+
+        void ProjectRange(const Query& a_query, const Candidates& a_candidates, size_t a_begin, Result& a_result) {
+            const float limit = 1.f + a_query.screenMargin;
+
+            for (size_t i = a_begin; i < a_candidates.Size(); ++i) {
+                float x = a_candidates.x[i];
+                float y = a_candidates.y[i];
+                float z = a_candidates.z[i];
+
+                float vx = x - a_query.origin[0];
+                float vy = y - a_query.origin[1];
+                float vz = z - a_query.origin[2];
+                float distance = std::sqrt(vx * vx + vy * vy + vz * vz);
+                if (distance > a_query.maxDistance || distance < kMinDistance) {
+                    continue;
+                }
+                float cosAngle = (vx * a_query.forward[0] + vy * a_query.forward[1] + vz * a_query.forward[2]) / distance;
+                if (cosAngle < a_query.cosMaxAngle) {
+                    continue;
+                }
+
+                float screenX = 0.f;
+                float screenY = 0.f;
+                if (auto* camera = a_query.camera) {
+                    auto& m = camera->worldToCam;
+                    float cx = m[0][0] * x + m[0][1] * y + m[0][2] * z + m[0][3];
+                    float cy = m[1][0] * x + m[1][1] * y + m[1][2] * z + m[1][3];
+                    float cw = m[3][0] * x + m[3][1] * y + m[3][2] * z + m[3][3];
+                    if (cw <= kMinW || std::abs(cx) > cw * limit || std::abs(cy) > cw * limit) {
+                        continue;
+                    }
+                    float invW = 1.f / cw;
+                    screenX = camera->left + (camera->right - camera->left) * (cx * invW * 0.5f + 0.5f);
+                    screenY = camera->bottom + (camera->top - camera->bottom) * (cy * invW * 0.5f + 0.5f);
+                }
+                Append(a_result, i, cosAngle, distance, screenX, screenY);
+            }
+        }
+    }
+
+    void Result::Reserve(size_t a_size) {
+        if (indices.size() < a_size) {
+            indices.resize(a_size);
+            cosAngle.resize(a_size);
+            distance.resize(a_size);
+            screenX.resize(a_size);
+            screenY.resize(a_size);
+        }
+    }
+
+    size_t Project(const Query& a_query, const Candidates& a_candidates, Result& a_result) {
+        static const bool hasAVX2 = HasAVX2();
+        return hasAVX2 ? ProjectAVX2(a_query, a_candidates, a_result) : ProjectScalar(a_query, a_candidates, a_result);
+    }
+
+    size_t ProjectScalar(const Query& a_query, const Candidates& a_candidates, Result& a_result) {
+        a_result.Reserve(a_candidates.Size());
+        a_result.count = 0;
+        ProjectRange(a_query, a_candidates, 0, a_result);
+        return a_result.count;
+    }
+
+    SECONDSIGHT_TARGET_AVX2 size_t ProjectAVX2(const Query& a_query, const Candidates& a_candidates, Result& a_result) {
+        a_result.Reserve(a_candidates.Size());
+        a_result.count = 0;
+
+        const size_t size = a_candidates.Size();
+        const float* xs = a_candidates.x.data();
+        const float* ys = a_candidates.y.data();
+        const float* zs = a_candidates.z.data();
+
+        const __m256 ox = _mm256_set1_ps(a_query.origin[0]);
+        const __m256 oy = _mm256_set1_ps(a_query.origin[1]);
+        const __m256 oz = _mm256_set1_ps(a_query.origin[2]);
+        const __m256 fx = _mm256_set1_ps(a_query.forward[0]);
+        const __m256 fy = _mm256_set1_ps(a_query.forward[1]);
+        const __m256 fz = _mm256_set1_ps(a_query.forward[2]);
+        const __m256 maxDistance = _mm256_set1_ps(a_query.maxDistance);
+        const __m256 minDistance = _mm256_set1_ps(kMinDistance);
+        const __m256 cosMaxAngle = _mm256_set1_ps(a_query.cosMaxAngle);
+        const __m256 minW = _mm256_set1_ps(kMinW);
+        const __m256 limit = _mm256_set1_ps(1.f + a_query.screenMargin);
+        const __m256 signMask = _mm256_set1_ps(-0.f);
+        const __m256 half = _mm256_set1_ps(0.5f);
+
+        const auto* camera = a_query.camera;
+        __m256 m[3][4] = {};    // rows x, y and w of the matrix, broadcast
+        __m256 left{}, width{}, bottom{}, height{};
+        if (camera) {
+            constexpr int kRows[3] = { 0, 1, 3 };
+            for (int r = 0; r < 3; ++r) {
+                for (int c = 0; c < 4; ++c) {
+                    m[r][c] = _mm256_set1_ps(camera->worldToCam[kRows[r]][c]);
+                }
+            }
+            left = _mm256_set1_ps(camera->left);
+            width = _mm256_set1_ps(camera->right - camera->left);
+            bottom = _mm256_set1_ps(camera->bottom);
+            height = _mm256_set1_ps(camera->top - camera->bottom);
+        }
+
+        alignas(32) float cosOut[8];
+        alignas(32) float distanceOut[8];
+        alignas(32) float screenXOut[8] = {};
+        alignas(32) float screenYOut[8] = {};
+
+        size_t i = 0;
+        for (; i + 8 <= size; i += 8) {
+            __m256 x = _mm256_loadu_ps(xs + i);
+            __m256 y = _mm256_loadu_ps(ys + i);
+            __m256 z = _mm256_loadu_ps(zs + i);
+
+            __m256 vx = _mm256_sub_ps(x, ox);
+            __m256 vy = _mm256_sub_ps(y, oy);
+            __m256 vz = _mm256_sub_ps(z, oz);
+            __m256 distance = _mm256_sqrt_ps(_mm256_fmadd_ps(vx, vx, _mm256_fmadd_ps(vy, vy, _mm256_mul_ps(vz, vz))));
+            __m256 dot = _mm256_fmadd_ps(vx, fx, _mm256_fmadd_ps(vy, fy, _mm256_mul_ps(vz, fz)));
+            __m256 cosAngle = _mm256_div_ps(dot, _mm256_max_ps(distance, minDistance));
+
+            __m256 mask = _mm256_and_ps(_mm256_cmp_ps(distance, maxDistance, _CMP_LE_OQ), _mm256_cmp_ps(distance, minDistance, _CMP_GE_OQ));
+            mask = _mm256_and_ps(mask, _mm256_cmp_ps(cosAngle, cosMaxAngle, _CMP_GE_OQ));
+            if (_mm256_movemask_ps(mask) == 0) {
+                continue;
+            }
+
+            if (camera) {
+                __m256 cx = _mm256_fmadd_ps(m[0][0], x, _mm256_fmadd_ps(m[0][1], y, _mm256_fmadd_ps(m[0][2], z, m[0][3])));
+                __m256 cy = _mm256_fmadd_ps(m[1][0], x, _mm256_fmadd_ps(m[1][1], y, _mm256_fmadd_ps(m[1][2], z, m[1][3])));
+                __m256 cw = _mm256_fmadd_ps(m[2][0], x, _mm256_fmadd_ps(m[2][1], y, _mm256_fmadd_ps(m[2][2], z, m[2][3])));
+                __m256 edge = _mm256_mul_ps(cw, limit);
+                mask = _mm256_and_ps(mask, _mm256_cmp_ps(cw, minW, _CMP_GT_OQ));
+                mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_andnot_ps(signMask, cx), edge, _CMP_LE_OQ));
+                mask = _mm256_and_ps(mask, _mm256_cmp_ps(_mm256_andnot_ps(signMask, cy), edge, _CMP_LE_OQ));
+                if (_mm256_movemask_ps(mask) == 0) {
+                    continue;
+                }
+
+                __m256 invW = _mm256_div_ps(_mm256_set1_ps(1.f), cw);
+                _mm256_store_ps(screenXOut, _mm256_fmadd_ps(width, _mm256_fmadd_ps(_mm256_mul_ps(cx, invW), half, half), left));
+                _mm256_store_ps(screenYOut, _mm256_fmadd_ps(height, _mm256_fmadd_ps(_mm256_mul_ps(cy, invW), half, half), bottom));
+            }
+
+            _mm256_store_ps(cosOut, cosAngle);
+            _mm256_store_ps(distanceOut, distance);
+            for (auto bits = static_cast<unsigned>(_mm256_movemask_ps(mask)); bits; bits &= bits - 1) {
+                auto lane = std::countr_zero(bits);
+                Append(a_result, i + lane, cosOut[lane], distanceOut[lane], screenXOut[lane], screenYOut[lane]);
+            }
+        }
+
+        ProjectRange(a_query, a_candidates, i, a_result);
+        return a_result.count;
+    }
+
+    bool HasAVX2() {
+#if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        if (info[0] < 7) {
+            return false;
+        }
+        __cpuid(info, 1);
+        constexpr int kFMA = 1 << 12, kOSXSAVE = 1 << 27, kAVX = 1 << 28;
+        if ((info[2] & (kFMA | kOSXSAVE | kAVX)) != (kFMA | kOSXSAVE | kAVX) || (_xgetbv(0) & 6) != 6) {
+            return false;
+        }
+        __cpuidex(info, 7, 0);
+        return (info[1] & (1 << 5)) != 0;
+#elif defined(__GNUC__) || defined(__clang__)
+        return __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+#else
+        return false;
+#endif
+    }
+} // namespace SecondSight::ScreenProjection
@@ -0,0 +1,71 @@
+#include "SpatialGrid.h"
+
+#include <algorithm>
+
+namespace SecondSight {
+    bool SpatialGrid::Update(ID a_id, const Point& a_position) {
+        auto cell = CellCoord(a_position.x, a_position.y);
+        auto cellKey = CellKey(cell.first, cell.second);
+
+        auto [it, inserted] = m_entries.try_emplace(a_id);
+        auto& entry = it->second;
+        entry.generation = m_generation;
+        entry.position = a_position;
+
+        if (inserted) {
+            entry.cellKey = cellKey;
+            m_cells[cellKey].push_back(a_id);
+        } else if (entry.cellKey != cellKey) {
+            // moved across a cell boundary, relocate only this entry
+            RemoveFromCell(a_id, entry.cellKey);
+            entry.cellKey = cellKey;
+            m_cells[cellKey].push_back(a_id);
+        }
+        return inserted;
+    }
+
+    const std::vector<SpatialGrid::ID>& SpatialGrid::EndSync() {
+        m_removed.clear();
+        for (auto& [id, entry] : m_entries) {
+            if (entry.generation != m_generation) {
+                m_removed.push_back(id);
+            }
+        }
+        for (auto id : m_removed) {
+            RemoveFromCell(id, m_entries[id].cellKey);
+            m_entries.erase(id);
+        }
+        return m_removed;
+    }
+
+    bool SpatialGrid::Remove(ID a_id) {
+        auto it = m_entries.find(a_id);
+        if (it == m_entries.end()) {
+            return false;
+        }
+        RemoveFromCell(a_id, it->second.cellKey);
+        m_entries.erase(it);
+        return true;
+    }
+
+    void SpatialGrid::Clear() {
+        m_entries.clear();
+        m_cells.clear();
+        m_removed.clear();
+    }
+
+    void SpatialGrid::RemoveFromCell(ID a_id, std::int64_t a_cellKey) {
+        auto it = m_cells.find(a_cellKey);
+        if (it == m_cells.end()) {
+            return;
+        }
+        auto& ids = it->second;
+        auto pos = std::find(ids.begin(), ids.end(), a_id);
+        if (pos != ids.end()) {
+            *pos = ids.back();
+            ids.pop_back();
+        }
+        // empty cells are kept with their capacity, so points moving back and forth across a cell
+        // boundary do not allocate; Clear() releases them
+    }
+} // namespace SecondSight
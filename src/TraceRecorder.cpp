@@ -0,0 +1,65 @@
+#include "TraceRecorder.h"
+
+#include <fstream>
+#include <thread>
+
+namespace SecondSight {
+    void TraceRecorder::SetEnabled(bool a_enabled) {
+        if (a_enabled == IsEnabled()) {
+            return;
+        }
+
+        if (a_enabled) {
+            if (!m_events) {
+                m_events = std::make_unique<Event[]>(kCapacity);
+            }
+            m_origin = std::chrono::steady_clock::now();
+            m_next.store(0, std::memory_order_relaxed);
+        }
+        m_enabled.store(a_enabled, std::memory_order_release);
+    }
+
+    void TraceRecorder::Record(const char* a_name, char a_phase, std::uint64_t a_arg) {
+        auto now = std::chrono::steady_clock::now();
+        auto index = m_next.fetch_add(1, std::memory_order_relaxed) % kCapacity;
+
+        auto& event = m_events[index];
+        event.name = a_name;
+        event.timestamp = std::chrono::duration_cast<std::chrono::microseconds>(now - m_origin).count();
+        event.arg = a_arg;
+        event.threadID = static_cast<std::uint32_t>(std::hash<std::thread::id>{}(std::this_thread::get_id()));
+        event.phase = a_phase;
+    }
+
+    bool TraceRecorder::Dump(const std::filesystem::path& a_path) const {
+        std::ofstream file(a_path, std::ios::trunc);
+        if (!file) {
+            return false;
+        }
+
+        auto next = m_next.load(std::memory_order_acquire);
+        auto count = m_events ? std::min<std::uint64_t>(next, kCapacity) : 0;
+
+        file << "{\"displayTimeUnit\":\"ms\",\"traceEvents\":[";
+        bool isFirst = true;
+        for (std::uint64_t i = 0; i < count; ++i) {
+            auto& event = m_events[(next - count + i) % kCapacity];
+            if (!event.name) {
+                continue;
+            }
+            if (!isFirst) {
+                file << ',';
+            }
+            isFirst = false;
+            file << "\n{\"name\":\"" << event.name << "\",\"cat\":\"SecondSight\",\"ph\":\"" << event.phase
+                 << "\",\"ts\":" << event.timestamp << ",\"pid\":1,\"tid\":" << event.threadID;
+            if (event.phase == 'i') {
+                file << ",\"s\":\"t\",\"args\":{\"value\":" << event.arg << '}';
+            }
+            file << '}';
+        }
+        file << "\n]}\n";
+
+        return static_cast<bool>(file);
+    }
+} // namespace SecondSight
@@ -0,0 +1,44 @@
+#include "TransitionHandoff.h"
+
+namespace SecondSight {
+    void TransitionHandoff::Begin(float a_duration, bool a_isArmed) {
+        m_duration = a_duration;
+        m_elapsed = 0.f;
+        m_heldFrames = 0;
+        m_isArmed = a_isArmed;
+        m_isArrivalPending = true;
+        m_isMeasuring = true;
+    }
+
+    void TransitionHandoff::OnTransitionFrame(float a_delta) {
+        if (m_isMeasuring && m_elapsed >= m_duration) {
+            // the playback already reached the end in an earlier frame and still holds it
+            ++m_heldFrames;
+        }
+        m_elapsed += a_delta;
+    }
+
+    TransitionHandoff::Action TransitionHandoff::OnPlaybackWait(bool a_isTransitionPlaying) {
+        if (!m_isArrivalPending) {
+            return Action::kNone;
+        }
+        if (a_isTransitionPlaying) {
+            m_isArrivalPending = false;
+            return Action::kSwitch;
+        }
+        if (m_isArmed) {
+            m_isArrivalPending = false;
+            return Action::kArrive;
+        }
+        // the transition was left some other way
+        return Action::kNone;
+    }
+
+    std::optional<std::uint32_t> TransitionHandoff::OnAtTargetFrame() {
+        if (!m_isMeasuring) {
+            return std::nullopt;
+        }
+        m_isMeasuring = false;
+        return m_heldFrames;
+    }
+} // namespace SecondSight
@@ -2,6 +2,13 @@
 #include "Hooks.h"
 #include "FreeCameraManager.h"
 #include "APIManager.h"
+#include "TraceRecorder.h"
+#include "ModAPI.h"
+#include "CameraPresets.h"
+#include "QualityGovernor.h"
+#include "APIProxies.h"
+#include "AutoDirector.h"
+#include "RewindRecorder.h"
 
 namespace SecondSight {
     namespace Interface {
@@ -10,17 +17,118 @@ namespace SecondSight {
         }
 
         bool StartSecondSightEffect(RE::StaticFunctionTag*) {
-            return FreeCameraManager::GetSingleton().StartSecondSightEffect(); 
+            TraceScope scope("Papyrus::StartSecondSightEffect");
+            return FreeCameraManager::GetSingleton().StartSecondSightEffect(CastQueue::Source::kPlayer);
         }
 
         void StopSecondSightEffect(RE::StaticFunctionTag*) {
+            TraceScope scope("Papyrus::StopSecondSightEffect");
             FreeCameraManager::GetSingleton().StopSecondSightEffect(); 
         }
+
+        bool HopSecondSightTarget(RE::StaticFunctionTag*) {
+            TraceScope scope("Papyrus::HopSecondSightTarget");
+            return FreeCameraManager::GetSingleton().HopToNextTarget();
+        }
+
+        bool StartSecondSightRewind(RE::StaticFunctionTag*, float a_seconds) {
+            TraceScope scope("Papyrus::StartSecondSightRewind");
+            return FreeCameraManager::GetSingleton().StartRewindEffect(a_seconds);
+        }
+
+        void SetSecondSightTraceEnabled(RE::StaticFunctionTag*, bool a_enabled) {
+            TraceRecorder::GetSingleton().SetEnabled(a_enabled);
+        }
+
+        bool DumpSecondSightTrace(RE::StaticFunctionTag*) {
+            auto path = SKSE::log::log_directory();
+            if (!path) {
+                log::error("{}: Could not determine log directory", __FUNCTION__);
+                return false;
+            }
+            *path /= "SecondSight_trace.json";
+
+            if (!TraceRecorder::GetSingleton().Dump(*path)) {
+                log::error("{}: Could not write {}", __FUNCTION__, path->string());
+                return false;
+            }
+            log::info("{}: Wrote trace to {}", __FUNCTION__, path->string());
+            return true;
+        }
+
+        bool DumpSecondSightAPIStats(RE::StaticFunctionTag*) {
+            if (!APIProxies::IsEnabled()) {
+                log::info("{}: API proxies are disabled (EnableAPIProxies in the [Debug] section of the INI), writing the cast queue statistics only", __FUNCTION__);
+            }
+
+            auto path = SKSE::log::log_directory();
+            if (!path) {
+                log::error("{}: Could not determine log directory", __FUNCTION__);
+                return false;
+            }
+            *path /= "SecondSight_api_stats.csv";
+
+            if (!APIProxies::Dump(*path)) {
+                log::error("{}: Could not write {}", __FUNCTION__, path->string());
+                return false;
+            }
+            log::info("{}: Wrote API statistics to {}", __FUNCTION__, path->string());
+            return true;
+        }
+
+        void SetSecondSightFramingMode(RE::StaticFunctionTag*, std::int32_t a_mode) {
+            if (a_mode < 0 || a_mode > static_cast<std::int32_t>(FreeCameraManager::FramingMode::kEyes)) {
+                log::warn("{}: Invalid framing mode {}", __FUNCTION__, a_mode);
+                return;
+            }
+            FreeCameraManager::GetSingleton().SetFramingMode(static_cast<FreeCameraManager::FramingMode>(a_mode));
+        }
+
+        bool IsSecondSightActive(RE::StaticFunctionTag*) {
+            return FreeCameraManager::GetSingleton().GetSnapshot().state != SecondSight_API::EffectState::kInactive;
+        }
+
+        std::int32_t GetSecondSightState(RE::StaticFunctionTag*) {
+            return static_cast<std::int32_t>(FreeCameraManager::GetSingleton().GetSnapshot().state);
+        }
+
+        RE::Actor* GetSecondSightTarget(RE::StaticFunctionTag*) {
+            auto snapshot = FreeCameraManager::GetSingleton().GetSnapshot();
+            if (snapshot.state == SecondSight_API::EffectState::kInactive || snapshot.target == 0) {
+                return nullptr;
+            }
+            auto ref = RE::TESObjectREFR::LookupByHandle(snapshot.target);
+            return ref ? ref->As<RE::Actor>() : nullptr;
+        }
+
+        float GetSecondSightLegTimeLeft(RE::StaticFunctionTag*) {
+            return FreeCameraManager::GetSingleton().GetSnapshot().legTimeLeft;
+        }
+
+        void SetSecondSightDirectorEnabled(RE::StaticFunctionTag*, bool a_enabled) {
+            AutoDirector::GetSingleton().SetEnabled(a_enabled);
+        }
+
+        RE::Actor* GetCrosshairTarget(RE::StaticFunctionTag*, float a_maxTargetDistance, float a_maxTargetScanAngle) {
+            return FreeCameraManager::GetSingleton().GetCrosshairTarget(a_maxTargetDistance, a_maxTargetScanAngle);
+        }
         
         bool SecondSightFunctions(RE::BSScript::Internal::VirtualMachine * a_vm){
             a_vm->RegisterFunction("GetSecondSightPluginVersion", "_ts_SecondSightFunctions", GetSecondSightPluginVersion);
             a_vm->RegisterFunction("StartSecondSightEffect", "_ts_SecondSightFunctions", StartSecondSightEffect);
             a_vm->RegisterFunction("StopSecondSightEffect", "_ts_SecondSightFunctions", StopSecondSightEffect);
+            a_vm->RegisterFunction("HopSecondSightTarget", "_ts_SecondSightFunctions", HopSecondSightTarget);
+            a_vm->RegisterFunction("StartSecondSightRewind", "_ts_SecondSightFunctions", StartSecondSightRewind);
+            a_vm->RegisterFunction("IsSecondSightActive", "_ts_SecondSightFunctions", IsSecondSightActive, true);
+            a_vm->RegisterFunction("GetSecondSightState", "_ts_SecondSightFunctions", GetSecondSightState, true);
+            a_vm->RegisterFunction("GetSecondSightTarget", "_ts_SecondSightFunctions", GetSecondSightTarget, true);
+            a_vm->RegisterFunction("GetSecondSightLegTimeLeft", "_ts_SecondSightFunctions", GetSecondSightLegTimeLeft, true);
+            a_vm->RegisterFunction("SetSecondSightFramingMode", "_ts_SecondSightFunctions", SetSecondSightFramingMode);
+            a_vm->RegisterFunction("SetSecondSightDirectorEnabled", "_ts_SecondSightFunctions", SetSecondSightDirectorEnabled);
+            a_vm->RegisterFunction("GetCrosshairTarget", "_ts_SecondSightFunctions", GetCrosshairTarget);
+            a_vm->RegisterFunction("SetSecondSightTraceEnabled", "_ts_SecondSightFunctions", SetSecondSightTraceEnabled);
+            a_vm->RegisterFunction("DumpSecondSightTrace", "_ts_SecondSightFunctions", DumpSecondSightTrace);
+            a_vm->RegisterFunction("DumpSecondSightAPIStats", "_ts_SecondSightFunctions", DumpSecondSightAPIStats);
             return true;
         }
     } // namespace Interface
@@ -33,6 +141,9 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 	switch (a_msg->type) {
 	case SKSE::MessagingInterface::kDataLoaded:
 		APIs::RequestAPIs();
+		APIs::InstallFallbacks();
+		SecondSight::CameraPresets::GetSingleton().Load();
+		SecondSight::AutoDirector::GetSingleton().RegisterEventSinks();
 		break;
 	case SKSE::MessagingInterface::kPostLoad:
 		APIs::RequestAPIs();
@@ -46,6 +157,7 @@ void MessageHandler(SKSE::MessagingInterface::Message* a_msg)
 	case SKSE::MessagingInterface::kNewGame:
 		APIs::RequestAPIs();
         SecondSight::FreeCameraManager::GetSingleton().Initialize();
+		SecondSight::RewindRecorder::GetSingleton().Clear();
 		break;
 	}
 }
@@ -58,6 +170,22 @@ SKSEPluginInfo(
     .MinimumSKSEVersion = { 2, 2, 3 } // or 0 if you want to support all
 )
 
+extern "C" DLLEXPORT void* SKSEAPI RequestPluginAPI(const SecondSight_API::InterfaceVersion a_interfaceVersion)
+{
+	auto api = Messaging::SecondSightInterface::GetSingleton();
+
+	log::info("SecondSight::RequestPluginAPI called, InterfaceVersion {}", static_cast<uint8_t>(a_interfaceVersion));
+
+	switch (a_interfaceVersion) {
+	case SecondSight_API::InterfaceVersion::V1:
+		log::info("SecondSight::RequestPluginAPI returned the API singleton");
+		return static_cast<void*>(api);
+	}
+
+	log::info("SecondSight::RequestPluginAPI requested the wrong interface version");
+	return nullptr;
+}
+
 extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* skse) {
     long logLevel = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "LogLevel:Log", "SKSE/Plugins/SecondSight.ini", 3L);
     bool isLogLevelValid = true;
@@ -72,6 +200,16 @@ extern "C" DLLEXPORT bool SKSEAPI SKSEPlugin_Load(const SKSE::LoadInterface* sks
     }
     log::info("{}: SecondSight Plugin version: {}", __FUNCTION__, SecondSight::Interface::GetSecondSightPluginVersion(nullptr));
 
+    long enableTrace = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "EnableTrace:Debug", "SKSE/Plugins/SecondSight.ini", 0L);
+    SecondSight::TraceRecorder::GetSingleton().SetEnabled(enableTrace != 0);
+    long enableAPIProxies = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "EnableAPIProxies:Debug", "SKSE/Plugins/SecondSight.ini", 0L);
+    SecondSight::APIProxies::SetEnabled(enableAPIProxies != 0);
+    SecondSight::QualityGovernor::GetSingleton().LoadSettings();
+    SecondSight::AutoDirector::GetSingleton().LoadSettings();
+    SecondSight::RewindRecorder::GetSingleton().LoadSettings();
+    long useNativeCameraDriver = _ts_SKSEFunctions::GetValueFromINI(nullptr, 0, "UseNativeCameraDriver:Settings", "SKSE/Plugins/SecondSight.ini", 0L);
+    APIs::UseNativeCameraDriver = useNativeCameraDriver != 0;
+
     Init(skse);
     auto messaging = SKSE::GetMessagingInterface();
 	if (!messaging->RegisterListener("SKSE", MessageHandler)) {
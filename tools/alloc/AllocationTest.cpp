@@ -0,0 +1,291 @@
+// Runs the self-contained parts of the per-frame and activation paths against the allocation counter
+// (AllocationCounter.cpp, built with SECONDSIGHT_TRACK_ALLOCATIONS) with a crowd of walking actors.
+//   activation: crosshair target (grid cone gather + batched projection), transition timing, long range
+//               plan, both timelines rebuilt, group members, rewind path decode
+//   frame:      the driver's playback (anchored key refresh, evaluation, global easing), long range stage,
+//               group rescan every kGroupRescanInterval and group framing
+// The grid sync and the rewind recording run in the player update, outside the frame scope, as in game.
+// Exits non-zero if a steady-state frame allocates or an activation exceeds AllocationTracker::kActivationBudget.
+//   AllocationTest [casts] [actors] [seed]
+#include "AllocationTracker.h"
+#include "CameraMath.h"
+#include "CameraTrack.h"
+#include "GroupFraming.h"
+#include "LongRangePlanner.h"
+#include "RewindBuffer.h"
+#include "ScreenProjection.h"
+#include "SpatialGrid.h"
+#include "TransitionTiming.h"
+
+#include <algorithm>
+#include <array>
+#include <cstdio>
+#include <cstdlib>
+#include <optional>
+#include <random>
+#include <vector>
+
+using namespace SecondSight;
+using CameraMath::Vec3;
+
+namespace {
+    constexpr float kFrameTime = 1.f / 60.f;
+    constexpr float kAnchorHeight = 100.f;          // ActorGrid::kAnchorHeight
+    constexpr float kMaxDistance = 30000.f;         // MaxDistance:LongRange
+    constexpr float kLongRangeSpeed = 8000.f;
+    constexpr float kGroupRadius = 1500.f;          // FreeCameraManager::kGroupRadius
+    constexpr float kGroupRescanInterval = 1.f;
+    constexpr float kAtTargetSeconds = 2.f;
+    constexpr float kRewindSeconds = 5.f;
+    constexpr size_t kRecordedActors = 32;          // RewindRecorder keeps the nearest actors only
+
+    struct Actor {
+        SpatialGrid::ID id = 0;
+        Vec3 position;
+        Vec3 velocity;
+    };
+
+    class Scene {
+        public:
+            Scene(size_t a_actorCount, std::uint32_t a_seed) : m_rng(a_seed), m_actors(a_actorCount) {
+                std::uniform_real_distribution<float> spread(-12000.f, 12000.f);
+                std::uniform_real_distribution<float> speed(-250.f, 250.f);
+                for (size_t i = 0; i < m_actors.size(); ++i) {
+                    m_actors[i] = { static_cast<SpatialGrid::ID>(0x800 + i), Vec3(spread(m_rng), spread(m_rng), 0.f), Vec3(speed(m_rng), speed(m_rng), 0.f) };
+                }
+                // a small crowd around the player, so there is always something in the crosshair and a group
+                for (size_t i = 0; i < std::min<size_t>(8, m_actors.size()); ++i) {
+                    m_actors[i].position = Vec3(1500.f + 150.f * i, 80.f * i, 0.f);
+                }
+            }
+
+            // FreeCameraManager::StartSecondSightEffect
+            bool Activate() {
+                auto target = FindCrosshairTarget();
+                if (!target) {
+                    return false;
+                }
+                m_target = *target;
+
+                Vec3 start = m_cameraPos;
+                Vec3 destination = Anchor(m_target) + Vec3(0.f, -300.f, 50.f);
+                float distance = CameraMath::Length(destination - start);
+                m_duration = m_timing.Compute(distance, kLongRangeSpeed);
+                m_plan = LongRange::BuildPlan(start, destination, m_duration, m_settings);
+                m_stage = 0;
+
+                // transition timeline: camera start, stage ends, target-anchored end
+                m_translation.Clear();
+                m_rotation.Clear();
+                m_translation.Add({ 0.f, start, true, false });
+                m_rotation.Add({ 0.f, Vec3(0.f, m_yaw, 0.f), true, false });
+                for (size_t i = 0; i + 1 < m_plan.stageCount; ++i) {
+                    m_translation.Add({ m_plan.stages[i].endTime, m_plan.stages[i].end, false, false });
+                }
+                m_targetKey = m_translation.Add({ m_duration, destination, false, true });
+                m_rotation.Add({ m_duration, Vec3(0.1f, m_yaw + 2.5f, 0.f), false, true });
+
+                UpdateGroupMembers();
+
+                // rewind casts replay the target's recent path first
+                m_rewindBuffer.Decode(m_target.id, m_time - kRewindSeconds, m_time, m_rewindPath);
+
+                m_playbackTime = 0.f;
+                return true;
+            }
+
+            // FreeCameraStateHook::Update: NativeCameraDriver::Update, then FreeCameraManager::Update
+            void UpdateCamera(float a_delta) {
+                m_playbackTime = std::min(m_playbackTime + a_delta, m_duration);
+                m_translation.SetValue(m_targetKey, Anchor(m_target) + Vec3(0.f, -300.f, 50.f));
+                float time = CameraTrack::Ease(m_duration > 0.f ? m_playbackTime / m_duration : 1.f, true, true) * m_duration;
+                m_cameraPos = m_translation.Evaluate(time);
+                m_rotationOut = m_rotation.Evaluate(time);
+
+                m_stage = m_plan.GetStage(m_playbackTime);
+
+                m_groupRescanTimer += a_delta;
+                if (m_groupRescanTimer >= kGroupRescanInterval) {
+                    UpdateGroupMembers();
+                }
+                for (size_t i = 0; i < m_groupCount; ++i) {
+                    m_framing.SetPoint(i, Anchor(m_groupMembers[i]));
+                }
+                m_bounds = m_framing.Compute();
+            }
+
+            // PlayerCharacterHook::Update: the world moves, the grid syncs, the recorder samples
+            void UpdatePlayer(float a_delta) {
+                m_time += a_delta;
+                m_yaw += 0.2f * a_delta;
+                m_grid.BeginSync();
+                for (size_t i = 0; i < m_actors.size(); ++i) {
+                    auto& actor = m_actors[i];
+                    actor.position = actor.position + actor.velocity * a_delta;
+                    m_grid.Update(actor.id, { actor.position.X(), actor.position.Y(), actor.position.Z() });
+                    if (i < kRecordedActors) {
+                        m_rewindBuffer.Record(actor.id, { m_time, actor.position.X(), actor.position.Y(), actor.position.Z(), 0.f });
+                    }
+                }
+                m_grid.EndSync();
+            }
+
+            float GetDuration() const { return m_duration; }
+
+        private:
+            std::optional<Actor> FindCrosshairTarget() {
+                Vec3 forward = CameraMath::ForwardFromPitchYaw(0.f, m_yaw);
+                m_candidates.Clear();
+                m_candidateIDs.clear();
+                m_grid.ForEachNearCone({ m_cameraPos.X(), m_cameraPos.Y(), m_cameraPos.Z() }, { forward.X(), forward.Y(), forward.Z() }, kMaxDistance, 180.f,
+                    [&](SpatialGrid::ID a_id, const SpatialGrid::Point& a_position) {
+                        m_candidates.Add(a_position.x, a_position.y, a_position.z + kAnchorHeight);
+                        m_candidateIDs.push_back(a_id);
+                    });
+
+                ScreenProjection::Query query;
+                query.origin[0] = m_cameraPos.X();
+                query.origin[1] = m_cameraPos.Y();
+                query.origin[2] = m_cameraPos.Z();
+                query.forward[0] = forward.X();
+                query.forward[1] = forward.Y();
+                query.forward[2] = forward.Z();
+                query.maxDistance = kMaxDistance;
+                query.cosMaxAngle = -1.f;
+                auto count = ScreenProjection::Project(query, m_candidates, m_projection);
+
+                std::optional<Actor> best;
+                float bestCos = -2.f;
+                for (size_t i = 0; i < count; ++i) {
+                    if (m_projection.cosAngle[i] > bestCos) {
+                        bestCos = m_projection.cosAngle[i];
+                        best = FindActor(m_candidateIDs[m_projection.indices[i]]);
+                    }
+                }
+                return best;
+            }
+
+            // FreeCameraManager::UpdateGroupMembers
+            void UpdateGroupMembers() {
+                m_groupRescanTimer = 0.f;
+                m_framing.Clear();
+                m_groupCount = 0;
+                auto addMember = [&](const Actor& a_actor) {
+                    auto index = m_framing.AddPoint(Anchor(a_actor));
+                    if (index < m_groupMembers.size()) {
+                        m_groupMembers[index] = a_actor;
+                        m_groupCount = index + 1;
+                    }
+                };
+                addMember(m_target);
+                auto center = Anchor(m_target);
+                m_grid.ForEachInRadius({ center.X(), center.Y(), center.Z() - kAnchorHeight }, kGroupRadius, [&](SpatialGrid::ID a_id, const SpatialGrid::Point&) {
+                    if (a_id != m_target.id) {
+                        addMember(FindActor(a_id));
+                    }
+                });
+            }
+
+            const Actor& FindActor(SpatialGrid::ID a_id) const {
+                return m_actors[a_id - 0x800];
+            }
+
+            Vec3 Anchor(const Actor& a_actor) const {
+                return FindActor(a_actor.id).position + Vec3(0.f, 0.f, kAnchorHeight);
+            }
+
+            // members
+            std::mt19937 m_rng;
+            std::vector<Actor> m_actors;
+            SpatialGrid m_grid;
+            RewindBuffer m_rewindBuffer;
+            std::vector<RewindBuffer::Sample> m_rewindPath;
+            ScreenProjection::Candidates m_candidates;
+            std::vector<SpatialGrid::ID> m_candidateIDs;
+            ScreenProjection::Result m_projection;
+            TransitionTiming m_timing;
+            LongRange::Settings m_settings;
+            LongRange::Plan m_plan;
+            size_t m_stage = 0;
+            CameraTrack m_translation;
+            CameraTrack m_rotation{ true };
+            size_t m_targetKey = 0;
+            GroupFraming m_framing;
+            GroupFraming::Bounds m_bounds;
+            std::array<Actor, GroupFraming::kMaxPoints> m_groupMembers{};
+            size_t m_groupCount = 0;
+            float m_groupRescanTimer = 0.f;
+            Actor m_target;
+            Vec3 m_cameraPos{ 0.f, 0.f, 150.f };
+            Vec3 m_rotationOut;
+            float m_yaw = 0.f;
+            float m_time = 0.f;
+            float m_duration = 0.f;
+            float m_playbackTime = 0.f;
+    };
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t casts = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 200;
+    size_t actorCount = a_argc > 2 ? std::strtoul(a_argv[2], nullptr, 10) : 500;
+    std::uint32_t seed = a_argc > 3 ? static_cast<std::uint32_t>(std::strtoul(a_argv[3], nullptr, 10)) : 1;
+    if (casts == 0 || actorCount == 0) {
+        return 2;
+    }
+
+    Scene scene(actorCount, seed);
+    // a few seconds of recorded history before the first cast
+    for (size_t i = 0; i < 300; ++i) {
+        scene.UpdatePlayer(kFrameTime);
+    }
+
+    size_t activations = 0;
+    std::uint64_t firstActivation = 0;
+    std::uint64_t maxActivation = 0;
+    size_t overBudget = 0;
+    size_t frames = 0;
+    size_t allocatingFrames = 0;
+    std::uint64_t frameAllocations = 0;
+
+    for (size_t cast = 0; cast < casts; ++cast) {
+        auto start = AllocationTracker::GetThreadCount();
+        bool isActive = scene.Activate();
+        auto count = AllocationTracker::GetThreadCount() - start;
+        if (!isActive) {
+            scene.UpdatePlayer(kFrameTime);
+            continue;
+        }
+        if (activations++ == 0) {
+            firstActivation = count;
+        }
+        maxActivation = std::max(maxActivation, count);
+        if (count > AllocationTracker::kActivationBudget) {
+            ++overBudget;
+        }
+
+        auto frameCount = static_cast<size_t>((scene.GetDuration() + kAtTargetSeconds) / kFrameTime);
+        for (size_t frame = 0; frame < frameCount; ++frame) {
+            scene.UpdatePlayer(kFrameTime);
+
+            start = AllocationTracker::GetThreadCount();
+            scene.UpdateCamera(kFrameTime);
+            count = AllocationTracker::GetThreadCount() - start;
+            ++frames;
+            if (count > 0) {
+                ++allocatingFrames;
+                frameAllocations += count;
+            }
+        }
+    }
+
+    std::printf("%zu activations: first %llu allocations, max %llu, budget %llu, %zu over budget\n", activations,
+        static_cast<unsigned long long>(firstActivation), static_cast<unsigned long long>(maxActivation),
+        static_cast<unsigned long long>(AllocationTracker::kActivationBudget), overBudget);
+    std::printf("%zu frames: %zu allocated (%llu allocations)\n", frames, allocatingFrames, static_cast<unsigned long long>(frameAllocations));
+
+    if (activations == 0) {
+        std::fprintf(stderr, "no activation found a target\n");
+        return 1;
+    }
+    return overBudget == 0 && allocatingFrames == 0 ? 0 : 1;
+}
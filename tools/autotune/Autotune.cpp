@@ -0,0 +1,260 @@
+// Offline tuning of the transition to the target: the duration curve of ComputeTransitionTime and the
+// TargetLookAt keyframe times of the TransitionToTarget preset. Every parameter set is played through
+// the camera tracks for each scenario on all cores; the search refines a grid around the best set.
+// Writes SecondSight_Autotune.ini ([Transition] section) and SecondSight_Presets.csv.
+//
+//   Autotune [--scenarios N] [--seed N] [--scenario file.csv]... [--grid N] [--rounds N] [--threads N]
+//            [--w-angular W] [--w-jerk W] [--w-duration W] [--w-visibility W] [--out DIR]
+#include "Simulator.h"
+#include "ThreadPool.h"
+
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <limits>
+#include <string>
+
+using namespace SecondSight;
+using namespace SecondSight::Tools;
+
+namespace {
+    constexpr size_t kDimensions = 6;
+
+    struct Range {
+        const char* name;
+        float min;
+        float max;
+    };
+
+    // the search space, also the limits for the refined ranges
+    constexpr std::array<Range, kDimensions> kSpace{ {
+        { "MinDistance", 0.f, 4000.f },
+        { "MaxDistance", 4000.f, 16000.f },
+        { "MinTime", 0.3f, 1.5f },
+        { "MaxTime", 1.f, 4.f },
+        { "LookAtStart", 0.05f, 0.5f },
+        { "LookAtEnd", 0.2f, 0.9f },
+    } };
+
+    using Point = std::array<float, kDimensions>;
+
+    Parameters ToParameters(const Point& a_point) {
+        Parameters parameters;
+        parameters.timing.minDistance = a_point[0];
+        parameters.timing.maxDistance = a_point[1];
+        parameters.timing.minTime = a_point[2];
+        parameters.timing.maxTime = a_point[3];
+        parameters.lookAtStart = a_point[4];
+        parameters.lookAtEnd = a_point[5];
+        return parameters;
+    }
+
+    Point FromParameters(const Parameters& a_parameters) {
+        return { a_parameters.timing.minDistance, a_parameters.timing.maxDistance, a_parameters.timing.minTime,
+                 a_parameters.timing.maxTime, a_parameters.lookAtStart, a_parameters.lookAtEnd };
+    }
+
+    struct Result {
+        Point point{};
+        Score score;   // averaged over the scenarios
+    };
+
+    Result Evaluate(const Point& a_point, const std::vector<Scenario>& a_scenarios, const Weights& a_weights) {
+        Result result;
+        result.point = a_point;
+        auto parameters = ToParameters(a_point);
+        if (!parameters.IsValid()) {
+            result.score.total = std::numeric_limits<float>::infinity();
+            return result;
+        }
+
+        for (auto& scenario : a_scenarios) {
+            auto score = Simulate(scenario, parameters, a_weights);
+            result.score.angularVelocity += score.angularVelocity;
+            result.score.jerk += score.jerk;
+            result.score.duration += score.duration;
+            result.score.visibility += score.visibility;
+            result.score.total += score.total;
+        }
+        float count = static_cast<float>(a_scenarios.size());
+        result.score.angularVelocity /= count;
+        result.score.jerk /= count;
+        result.score.duration /= count;
+        result.score.visibility /= count;
+        result.score.total /= count;
+        return result;
+    }
+
+    void Print(const char* a_label, const Result& a_result) {
+        std::printf("%-10s score %7.3f | angular %5.2f rad/s, jerk %6.1f, duration %4.2f s, visible %5.1f%% |", a_label,
+            a_result.score.total, a_result.score.angularVelocity, a_result.score.jerk, a_result.score.duration,
+            a_result.score.visibility * 100.f);
+        for (size_t d = 0; d < kDimensions; ++d) {
+            std::printf(" %s=%g", kSpace[d].name, a_result.point[d]);
+        }
+        std::printf("\n");
+    }
+
+    bool WriteIni(const std::filesystem::path& a_path, const Result& a_best, const Result& a_baseline, size_t a_scenarioCount) {
+        std::ofstream file(a_path, std::ios::trunc);
+        file << "; Generated by tools/autotune over " << a_scenarioCount << " scenarios, score " << a_best.score.total
+             << " (built-in defaults: " << a_baseline.score.total << ")\n";
+        file << "; Merge into SKSE/Plugins/SecondSight.ini, the keyframe times are in SecondSight_Presets.csv\n";
+        file << "[Transition]\n";
+        file << "MinDistance=" << a_best.point[0] << '\n';
+        file << "MaxDistance=" << a_best.point[1] << '\n';
+        file << "MinTime=" << a_best.point[2] << '\n';
+        file << "MaxTime=" << a_best.point[3] << '\n';
+        return file.good();
+    }
+
+    bool WritePresets(const std::filesystem::path& a_path, const Result& a_best) {
+        std::ofstream file(a_path, std::ios::trunc);
+        file << "# SecondSight camera presets, TransitionToTarget look-at times generated by tools/autotune\n"
+                "# Leg:     TransitionToTarget | AtTarget | TransitionToPrevious\n"
+                "# Channel: Translation | Rotation\n"
+                "# Anchor:  Camera | Target | TargetLookAt | Return\n"
+                "# Time:    fraction of the leg's duration (0..1)\n"
+                "Leg,Channel,Anchor,Time,EaseIn,EaseOut\n"
+                "TransitionToTarget,Translation,Camera,0.0,1,1\n"
+                "TransitionToTarget,Rotation,Camera,0.0,1,1\n"
+                "# finished rotating towards the movement direction\n"
+             << "TransitionToTarget,Rotation,TargetLookAt," << a_best.point[4] << ",1,1\n"
+             << "# start rotating towards the target\n"
+             << "TransitionToTarget,Rotation,TargetLookAt," << a_best.point[5] << ",1,1\n"
+             << "TransitionToTarget,Translation,Target,1.0,1,1\n"
+                "TransitionToTarget,Rotation,Target,1.0,1,1\n"
+                "AtTarget,Translation,Target,0.0,1,1\n"
+                "AtTarget,Rotation,Target,0.0,1,1\n"
+                "TransitionToPrevious,Translation,Camera,0.0,1,1\n"
+                "TransitionToPrevious,Rotation,Camera,0.0,1,1\n"
+                "TransitionToPrevious,Rotation,TargetLookAt,0.5,1,1\n"
+                "TransitionToPrevious,Translation,Return,1.0,1,1\n"
+                "TransitionToPrevious,Rotation,Return,1.0,1,1\n";
+        return file.good();
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t scenarioCount = 128;
+    std::uint32_t seed = 1;
+    std::vector<std::string> scenarioFiles;
+    size_t gridSize = 4;
+    size_t rounds = 3;
+    size_t threadCount = std::thread::hardware_concurrency();
+    Weights weights;
+    std::filesystem::path outDir = ".";
+
+    for (int i = 1; i < a_argc; ++i) {
+        std::string arg = a_argv[i];
+        const char* value = i + 1 < a_argc ? a_argv[i + 1] : nullptr;
+        if (!value) {
+            std::fprintf(stderr, "Missing value for %s\n", arg.c_str());
+            return 2;
+        }
+        ++i;
+        if (arg == "--scenarios") {
+            scenarioCount = std::strtoul(value, nullptr, 10);
+        } else if (arg == "--seed") {
+            seed = static_cast<std::uint32_t>(std::strtoul(value, nullptr, 10));
+        } else if (arg == "--scenario") {
+            scenarioFiles.emplace_back(value);
+        } else if (arg == "--grid") {
+            gridSize = std::max<size_t>(std::strtoul(value, nullptr, 10), 2);
+        } else if (arg == "--rounds") {
+            rounds = std::max<size_t>(std::strtoul(value, nullptr, 10), 1);
+        } else if (arg == "--threads") {
+            threadCount = std::strtoul(value, nullptr, 10);
+        } else if (arg == "--w-angular") {
+            weights.angularVelocity = std::strtof(value, nullptr);
+        } else if (arg == "--w-jerk") {
+            weights.jerk = std::strtof(value, nullptr);
+        } else if (arg == "--w-duration") {
+            weights.duration = std::strtof(value, nullptr);
+        } else if (arg == "--w-visibility") {
+            weights.visibility = std::strtof(value, nullptr);
+        } else if (arg == "--out") {
+            outDir = value;
+        } else {
+            std::fprintf(stderr, "Unknown option %s\n", arg.c_str());
+            return 2;
+        }
+    }
+
+    auto scenarios = GenerateScenarios(scenarioCount, seed);
+    for (auto& path : scenarioFiles) {
+        Scenario scenario;
+        if (!LoadScenario(path, scenario)) {
+            std::fprintf(stderr, "Could not read scenario %s\n", path.c_str());
+            return 1;
+        }
+        scenarios.push_back(std::move(scenario));
+    }
+    if (scenarios.empty()) {
+        std::fprintf(stderr, "No scenarios\n");
+        return 2;
+    }
+
+    ThreadPool pool(threadCount);
+    std::printf("%zu scenarios, %zu^%zu grid, %zu rounds, %zu threads\n", scenarios.size(), gridSize, kDimensions, rounds, pool.GetSize());
+
+    auto baseline = Evaluate(FromParameters(Parameters()), scenarios, weights);
+    Print("defaults", baseline);
+
+    std::array<std::pair<float, float>, kDimensions> ranges;
+    for (size_t d = 0; d < kDimensions; ++d) {
+        ranges[d] = { kSpace[d].min, kSpace[d].max };
+    }
+
+    Result best = baseline;
+    size_t configCount = 1;
+    for (size_t d = 0; d < kDimensions; ++d) {
+        configCount *= gridSize;
+    }
+    std::vector<Result> results(configCount);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t round = 0; round < rounds; ++round) {
+        pool.ParallelFor(configCount, [&](size_t a_index) {
+            Point point;
+            size_t index = a_index;
+            for (size_t d = 0; d < kDimensions; ++d) {
+                float step = static_cast<float>(index % gridSize) / static_cast<float>(gridSize - 1);
+                index /= gridSize;
+                point[d] = ranges[d].first + (ranges[d].second - ranges[d].first) * step;
+            }
+            results[a_index] = Evaluate(point, scenarios, weights);
+        });
+
+        for (auto& result : results) {
+            if (result.score.total < best.score.total) {
+                best = result;
+            }
+        }
+        char label[32];
+        std::snprintf(label, sizeof(label), "round %zu", round + 1);
+        Print(label, best);
+
+        // halve the ranges around the best point, within the search space
+        for (size_t d = 0; d < kDimensions; ++d) {
+            float halfSpan = (ranges[d].second - ranges[d].first) / 4.f;
+            ranges[d].first = std::max(best.point[d] - halfSpan, kSpace[d].min);
+            ranges[d].second = std::min(best.point[d] + halfSpan, kSpace[d].max);
+        }
+    }
+    auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+    std::printf("%zu simulations in %.1f s\n", configCount * rounds * scenarios.size(), elapsed);
+
+    std::filesystem::create_directories(outDir);
+    if (!WriteIni(outDir / "SecondSight_Autotune.ini", best, baseline, scenarios.size()) ||
+        !WritePresets(outDir / "SecondSight_Presets.csv", best)) {
+        std::fprintf(stderr, "Could not write the results to %s\n", outDir.string().c_str());
+        return 1;
+    }
+    std::printf("Wrote %s and %s\n", (outDir / "SecondSight_Autotune.ini").string().c_str(),
+        (outDir / "SecondSight_Presets.csv").string().c_str());
+    return 0;
+}
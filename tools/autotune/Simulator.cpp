@@ -0,0 +1,222 @@
+#include "Simulator.h"
+#include "CameraTrack.h"
+
+#include <algorithm>
+#include <cmath>
+#include <fstream>
+#include <random>
+#include <sstream>
+
+namespace SecondSight::Tools {
+    namespace {
+        using CameraMath::Vec3;
+
+        constexpr float kFrameTime = 1.f / 60.f;
+        constexpr float kPathLength = 8.f;              // seconds of synthetic target path
+        constexpr float kPathInterval = 1.f / 30.f;
+        const Vec3 kAnchorOffset(0.f, 20.f, 120.f);    // head, relative to the target's heading (UpdateTargetOffset)
+        const Vec3 kLookAtOffset(0.f, 0.f, 120.f);     // Actor::GetLookingAtLocation
+        constexpr float kHalfFov = 0.5f;                // radians, horizontal half-angle counted as on-screen
+        constexpr float kNearDistance = 300.f;          // closer than this the target fills the view anyway
+
+        Vec3 Rotate(const Vec3& a_offset, float a_heading) {
+            float s = std::sin(a_heading), c = std::cos(a_heading);
+            return Vec3(a_offset.X() * c + a_offset.Y() * s, -a_offset.X() * s + a_offset.Y() * c, a_offset.Z());
+        }
+
+        Vec3 AnchorAt(const Scenario::TargetSample& a_sample) {
+            return a_sample.position + Rotate(kAnchorOffset, a_sample.heading);
+        }
+    }
+
+    Scenario::TargetSample Scenario::Sample(float a_time) const {
+        if (path.empty()) {
+            return {};
+        }
+        if (a_time <= path.front().time) {
+            return path.front();
+        }
+        if (a_time >= path.back().time) {
+            return path.back();
+        }
+        auto it = std::upper_bound(path.begin(), path.end(), a_time, [](float a_t, const TargetSample& a_sample) {
+            return a_t < a_sample.time;
+        });
+        auto& next = *it;
+        auto& prev = *(it - 1);
+        float t = (a_time - prev.time) / std::max(next.time - prev.time, 1e-6f);
+
+        TargetSample sample;
+        sample.time = a_time;
+        sample.position = CameraMath::Lerp(prev.position, next.position, t);
+        sample.heading = prev.heading + CameraMath::NormalizeAngle(next.heading - prev.heading) * t;
+        return sample;
+    }
+
+    std::vector<Scenario> GenerateScenarios(size_t a_count, std::uint32_t a_seed) {
+        std::mt19937 rng(a_seed);
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+        constexpr float kSpeeds[] = { 0.f, 100.f, 350.f, 550.f };
+        constexpr const char* kMotions[] = { "standing", "walking", "running", "sprinting" };
+
+        std::vector<Scenario> scenarios(a_count);
+        for (size_t i = 0; i < a_count; ++i) {
+            auto& scenario = scenarios[i];
+
+            // log-uniform distance between 300 and 12000 units, mostly in front of the camera
+            float distance = 300.f * std::pow(40.f, unit(rng));
+            float bearing = (unit(rng) < 0.9f ? (unit(rng) - 0.5f) * 1.5f : (unit(rng) - 0.5f) * CameraMath::kTwoPi);
+            float cameraYaw = (unit(rng) - 0.5f) * CameraMath::kTwoPi;
+            scenario.cameraPosition = Vec3(0.f, 0.f, 120.f + unit(rng) * 200.f);
+            scenario.cameraRotation = CameraMath::PitchYaw{ (unit(rng) - 0.3f) * 0.4f, cameraYaw };
+
+            float targetYaw = cameraYaw + bearing;
+            Vec3 position(std::sin(targetYaw) * distance, std::cos(targetYaw) * distance, (unit(rng) - 0.5f) * 0.2f * distance);
+            float heading = unit(rng) * CameraMath::kTwoPi;
+            size_t motion = static_cast<size_t>(unit(rng) * 4.f) % 4;
+            float turnRate = (unit(rng) - 0.5f) * 2.f;
+
+            std::ostringstream name;
+            name << "synthetic_" << i << '_' << kMotions[motion] << '_' << static_cast<int>(distance);
+            scenario.name = name.str();
+
+            for (float time = 0.f; time <= kPathLength; time += kPathInterval) {
+                scenario.path.push_back({ time, position, CameraMath::NormalizeAngle(heading) });
+                heading += turnRate * kPathInterval;
+                position = position + Vec3(std::sin(heading), std::cos(heading), 0.f) * (kSpeeds[motion] * kPathInterval);
+            }
+        }
+        return scenarios;
+    }
+
+    bool LoadScenario(const std::string& a_path, Scenario& a_scenario) {
+        std::ifstream file(a_path);
+        if (!file) {
+            return false;
+        }
+
+        a_scenario = Scenario();
+        a_scenario.name = a_path;
+        bool hasCamera = false;
+        std::string line;
+        while (std::getline(file, line)) {
+            if (line.empty() || line[0] == '#' || line.rfind("Kind", 0) == 0) {
+                continue;
+            }
+            std::istringstream stream(line);
+            std::string kind;
+            std::getline(stream, kind, ',');
+            float values[6] = {};
+            for (auto& value : values) {
+                std::string cell;
+                std::getline(stream, cell, ',');
+                value = cell.empty() ? 0.f : std::strtof(cell.c_str(), nullptr);
+            }
+
+            Vec3 position(values[1], values[2], values[3]);
+            if (kind == "Camera") {
+                a_scenario.cameraPosition = position;
+                a_scenario.cameraRotation = CameraMath::PitchYaw{ values[4], values[5] };
+                hasCamera = true;
+            } else if (kind == "Target") {
+                a_scenario.path.push_back({ values[0], position, values[5] });
+            }
+        }
+
+        std::sort(a_scenario.path.begin(), a_scenario.path.end(), [](const auto& a_lhs, const auto& a_rhs) {
+            return a_lhs.time < a_rhs.time;
+        });
+        return hasCamera && !a_scenario.path.empty();
+    }
+
+    bool Parameters::IsValid() const {
+        return timing.minTime > 0.f && timing.maxTime >= timing.minTime &&
+               timing.maxDistance > timing.minDistance &&
+               lookAtStart > 0.f && lookAtEnd > lookAtStart && lookAtEnd < 1.f;
+    }
+
+    float GetStartDistance(const Scenario& a_scenario) {
+        return CameraMath::Length(AnchorAt(a_scenario.Sample(0.f)) - a_scenario.cameraPosition);
+    }
+
+    Score Simulate(const Scenario& a_scenario, const Parameters& a_parameters, const Weights& a_weights) {
+        return Simulate(a_scenario, a_parameters.timing, a_parameters.lookAtStart, a_parameters.lookAtEnd, a_weights);
+    }
+
+    Score SimulateLeg(const Scenario& a_scenario, float a_duration, float a_lookAtStart, float a_lookAtEnd, const Weights& a_weights) {
+        auto start = a_scenario.Sample(0.f);
+        float distance = CameraMath::Length(AnchorAt(start) - a_scenario.cameraPosition);
+        float duration = a_duration;
+
+        // the TransitionToTarget preset: camera -> target translation, camera -> look at -> look at -> target rotation
+        CameraTrack translation(false);
+        CameraTrack rotation(true);
+        translation.Add({ 0.f, a_scenario.cameraPosition, true, true });
+        size_t targetKey = translation.Add({ duration, AnchorAt(start), true, true });
+
+        Vec3 startRotation(a_scenario.cameraRotation.pitch, a_scenario.cameraRotation.yaw, 0.f);
+        rotation.Add({ 0.f, startRotation, true, true });
+        size_t lookAtStartKey = rotation.Add({ a_lookAtStart * duration, startRotation, true, true });
+        size_t lookAtEndKey = rotation.Add({ a_lookAtEnd * duration, startRotation, true, true });
+        size_t headingKey = rotation.Add({ duration, startRotation, true, true });
+
+        double angularSquares = 0.0;
+        double jerkSquares = 0.0;
+        size_t jerkSamples = 0;
+        size_t visibleFrames = 0;
+        size_t farFrames = 0;
+        Vec3 positions[4];
+        Vec3 previousRotation = startRotation;
+
+        size_t frameCount = static_cast<size_t>(std::ceil(duration / kFrameTime));
+        for (size_t frame = 0; frame <= frameCount; ++frame) {
+            float time = std::min(frame * kFrameTime, duration);
+            auto target = a_scenario.Sample(time);
+
+            // resolve the target-anchored keys, as the camera driver does every frame
+            translation.SetValue(targetKey, AnchorAt(target));
+            Vec3 position = translation.Evaluate(time);
+            Vec3 lookAtPoint = target.position + kLookAtOffset;
+            auto lookAt = CameraMath::LookAt(position, lookAtPoint, a_scenario.cameraRotation.yaw);
+            rotation.SetValue(lookAtStartKey, Vec3(lookAt.pitch, lookAt.yaw, 0.f));
+            rotation.SetValue(lookAtEndKey, Vec3(lookAt.pitch, lookAt.yaw, 0.f));
+            rotation.SetValue(headingKey, Vec3(0.f, target.heading, 0.f));
+            Vec3 cameraRotation = rotation.Evaluate(time);
+
+            if (frame > 0) {
+                float deltas[2] = { cameraRotation.X() - previousRotation.X(), cameraRotation.Y() - previousRotation.Y() };
+                CameraMath::NormalizeAngles(deltas, 2);
+                angularSquares += (deltas[0] * deltas[0] + deltas[1] * deltas[1]) / (kFrameTime * kFrameTime);
+            }
+            previousRotation = cameraRotation;
+
+            positions[0] = positions[1];
+            positions[1] = positions[2];
+            positions[2] = positions[3];
+            positions[3] = position;
+            if (frame >= 3) {
+                Vec3 jerk = (positions[3] - positions[2] * 3.f + positions[1] * 3.f - positions[0]) / (kFrameTime * kFrameTime * kFrameTime);
+                jerkSquares += CameraMath::Dot(jerk, jerk);
+                ++jerkSamples;
+            }
+
+            Vec3 toTarget = lookAtPoint - position;
+            if (CameraMath::Length(toTarget) > kNearDistance) {
+                ++farFrames;
+                Vec3 forward = CameraMath::ForwardFromPitchYaw(cameraRotation.X(), cameraRotation.Y());
+                if (CameraMath::Dot(forward, CameraMath::Normalize(toTarget)) >= std::cos(kHalfFov)) {
+                    ++visibleFrames;
+                }
+            }
+        }
+
+        Score score;
+        score.duration = duration;
+        score.angularVelocity = static_cast<float>(std::sqrt(angularSquares / std::max<size_t>(frameCount, 1)));
+        score.jerk = jerkSamples > 0 ? static_cast<float>(std::sqrt(jerkSquares / jerkSamples)) / std::max(distance, 100.f) : 0.f;
+        score.visibility = farFrames > 0 ? static_cast<float>(visibleFrames) / farFrames : 1.f;
+        score.total = a_weights.angularVelocity * score.angularVelocity + a_weights.jerk * score.jerk +
+                      a_weights.duration * score.duration + a_weights.visibility * (1.f - score.visibility);
+        return score;
+    }
+} // namespace SecondSight::Tools
@@ -0,0 +1,74 @@
+#pragma once
+
+#include "CameraMath.h"
+#include "TransitionTiming.h"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace SecondSight::Tools {
+
+    // A cast to replay: where the camera starts and how the target moves meanwhile.
+    struct Scenario {
+        struct TargetSample {
+            float time = 0.f;
+            CameraMath::Vec3 position;
+            float heading = 0.f;
+        };
+
+        std::string name;
+        CameraMath::Vec3 cameraPosition;
+        CameraMath::PitchYaw cameraRotation;
+        std::vector<TargetSample> path;     // increasing time, held at the last sample
+
+        TargetSample Sample(float a_time) const;
+    };
+
+    // Synthetic casts: mixed distances, targets standing, walking, running and turning
+    std::vector<Scenario> GenerateScenarios(size_t a_count, std::uint32_t a_seed);
+
+    // Recorded cast, CSV with the columns Kind,Time,X,Y,Z,Pitch,Yaw. One Camera row holds the start pose,
+    // Target rows the target's path (Yaw = heading). Returns false if the file could not be read.
+    bool LoadScenario(const std::string& a_path, Scenario& a_scenario);
+
+    // What the tuner varies: the duration curve of ComputeTransitionTime and the times of the two
+    // TargetLookAt rotation keyframes in the TransitionToTarget preset, as fractions of the leg.
+    struct Parameters {
+        TransitionTiming timing;
+        float lookAtStart = 0.2f;
+        float lookAtEnd = 0.5f;
+
+        bool IsValid() const;
+    };
+
+    struct Weights {
+        float angularVelocity = 1.f;    // per rad/s RMS
+        float jerk = 0.02f;             // per 1/s^3 RMS, jerk divided by the flight distance
+        float duration = 1.f;           // per second
+        float visibility = 5.f;         // per fraction of the flight the target is off-screen
+    };
+
+    struct Score {
+        float angularVelocity = 0.f;
+        float jerk = 0.f;
+        float duration = 0.f;
+        float visibility = 0.f;         // fraction of frames with the target in view
+        float total = 0.f;
+    };
+
+    // Distance from the camera to the target's anchor when the cast starts, what the duration is computed from
+    float GetStartDistance(const Scenario& a_scenario);
+
+    // Plays the TransitionToTarget leg of a_duration seconds at 60 Hz with CameraTrack, resolving the
+    // target-anchored keys every frame the way the built-in camera driver does, and scores the camera motion.
+    Score SimulateLeg(const Scenario& a_scenario, float a_duration, float a_lookAtStart, float a_lookAtEnd, const Weights& a_weights);
+
+    Score Simulate(const Scenario& a_scenario, const Parameters& a_parameters, const Weights& a_weights);
+
+    // Same with any transition policy, to compare duration curves
+    template <TransitionPolicy Timing>
+    Score Simulate(const Scenario& a_scenario, const Timing& a_timing, float a_lookAtStart, float a_lookAtEnd, const Weights& a_weights) {
+        return SimulateLeg(a_scenario, a_timing.Compute(GetStartDistance(a_scenario)), a_lookAtStart, a_lookAtEnd, a_weights);
+    }
+} // namespace SecondSight::Tools
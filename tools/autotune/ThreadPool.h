@@ -0,0 +1,96 @@
+#pragma once
+
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SecondSight::Tools {
+
+    // Fixed set of worker threads running index ranges. ParallelFor blocks until every index ran;
+    // workers pull indices from a shared counter, so uneven work balances itself.
+    class ThreadPool {
+        public:
+            explicit ThreadPool(size_t a_threadCount = std::thread::hardware_concurrency()) {
+                a_threadCount = a_threadCount > 0 ? a_threadCount : 1;
+                m_workers.reserve(a_threadCount);
+                for (size_t i = 0; i < a_threadCount; ++i) {
+                    m_workers.emplace_back([this] { Run(); });
+                }
+            }
+
+            ~ThreadPool() {
+                {
+                    std::lock_guard lock(m_mutex);
+                    m_isStopping = true;
+                }
+                m_wake.notify_all();
+                for (auto& worker : m_workers) {
+                    worker.join();
+                }
+            }
+
+            ThreadPool(const ThreadPool&) = delete;
+            ThreadPool& operator=(const ThreadPool&) = delete;
+
+            size_t GetSize() const { return m_workers.size(); }
+
+            void ParallelFor(size_t a_count, const std::function<void(size_t)>& a_func) {
+                if (a_count == 0) {
+                    return;
+                }
+                std::unique_lock lock(m_mutex);
+                m_func = &a_func;
+                m_count = a_count;
+                m_next.store(0, std::memory_order_relaxed);
+                m_busy = m_workers.size();
+                ++m_generation;
+                m_wake.notify_all();
+                m_done.wait(lock, [this] { return m_busy == 0; });
+                m_func = nullptr;
+            }
+
+        private:
+            void Run() {
+                size_t seen = 0;
+                while (true) {
+                    const std::function<void(size_t)>* func;
+                    size_t count;
+                    {
+                        std::unique_lock lock(m_mutex);
+                        m_wake.wait(lock, [&] { return m_isStopping || m_generation != seen; });
+                        if (m_isStopping) {
+                            return;
+                        }
+                        seen = m_generation;
+                        func = m_func;
+                        count = m_count;
+                    }
+
+                    for (size_t i = m_next.fetch_add(1, std::memory_order_relaxed); i < count; i = m_next.fetch_add(1, std::memory_order_relaxed)) {
+                        (*func)(i);
+                    }
+
+                    std::lock_guard lock(m_mutex);
+                    if (--m_busy == 0) {
+                        m_done.notify_one();
+                    }
+                }
+            }
+
+            // members
+            std::vector<std::thread> m_workers;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            const std::function<void(size_t)>* m_func = nullptr;
+            size_t m_count = 0;
+            std::atomic<size_t> m_next = 0;
+            size_t m_busy = 0;
+            size_t m_generation = 0;
+            bool m_isStopping = false;
+    }; // class ThreadPool
+} // namespace SecondSight::Tools
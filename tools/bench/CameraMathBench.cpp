@@ -0,0 +1,220 @@
+// CameraMath's SSE paths against plain scalar versions of the same math: batch angle wrapping (against the
+// NormalRelativeAngle loop the manager used before), vector normalize/cross/dot, quaternion rotation and
+// slerp. Each pair is also compared for the largest difference in its results.
+//   CameraMathBench [count]
+#include "CameraMath.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace SecondSight::CameraMath;
+
+namespace {
+    volatile float g_sink = 0.f;
+
+    namespace Scalar {
+        struct Vec3 {
+            float x, y, z;
+        };
+
+        struct Quat {
+            float x, y, z, w;
+        };
+
+        float NormalRelativeAngle(float a_angle) {
+            while (a_angle > kPi) {
+                a_angle -= kTwoPi;
+            }
+            while (a_angle < -kPi) {
+                a_angle += kTwoPi;
+            }
+            return a_angle;
+        }
+
+        float Dot(const Vec3& a_lhs, const Vec3& a_rhs) { return a_lhs.x * a_rhs.x + a_lhs.y * a_rhs.y + a_lhs.z * a_rhs.z; }
+
+        Vec3 Cross(const Vec3& a_lhs, const Vec3& a_rhs) {
+            return { a_lhs.y * a_rhs.z - a_lhs.z * a_rhs.y, a_lhs.z * a_rhs.x - a_lhs.x * a_rhs.z, a_lhs.x * a_rhs.y - a_lhs.y * a_rhs.x };
+        }
+
+        Vec3 Normalize(const Vec3& a_v) {
+            float length = std::sqrt(Dot(a_v, a_v));
+            return length > 1e-6f ? Vec3{ a_v.x / length, a_v.y / length, a_v.z / length } : Vec3{ 0.f, 0.f, 0.f };
+        }
+
+        Vec3 Rotate(const Quat& a_q, const Vec3& a_v) {
+            Vec3 q{ a_q.x, a_q.y, a_q.z };
+            Vec3 t = Cross(q, a_v);
+            t = { 2.f * t.x, 2.f * t.y, 2.f * t.z };
+            Vec3 u = Cross(q, t);
+            return { a_v.x + a_q.w * t.x + u.x, a_v.y + a_q.w * t.y + u.y, a_v.z + a_q.w * t.z + u.z };
+        }
+
+        Quat Slerp(const Quat& a_from, Quat a_to, float a_t) {
+            float cosTheta = a_from.x * a_to.x + a_from.y * a_to.y + a_from.z * a_to.z + a_from.w * a_to.w;
+            if (cosTheta < 0.f) {
+                a_to = { -a_to.x, -a_to.y, -a_to.z, -a_to.w };
+                cosTheta = -cosTheta;
+            }
+            float wFrom = 1.f - a_t, wTo = a_t;
+            if (cosTheta <= 0.9995f) {
+                float theta = std::acos(cosTheta);
+                float invSin = 1.f / std::sin(theta);
+                wFrom = std::sin((1.f - a_t) * theta) * invSin;
+                wTo = std::sin(a_t * theta) * invSin;
+            }
+            Quat q{ a_from.x * wFrom + a_to.x * wTo, a_from.y * wFrom + a_to.y * wTo, a_from.z * wFrom + a_to.z * wTo, a_from.w * wFrom + a_to.w * wTo };
+            float length = std::sqrt(q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w);
+            return { q.x / length, q.y / length, q.z / length, q.w / length };
+        }
+    }
+
+    template <class F>
+    double Time(size_t a_count, size_t a_passes, F&& a_func) {
+        a_func();
+        auto start = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < a_passes; ++pass) {
+            a_func();
+        }
+        return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / (a_passes * a_count);
+    }
+
+    void Print(const char* a_name, double a_scalar, double a_simd, float a_maxDifference) {
+        std::printf("%-22s scalar %6.2f ns  sse %6.2f ns  x%.2f  max difference %g\n", a_name, a_scalar, a_simd, a_scalar / a_simd, a_maxDifference);
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t count = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 4096;
+    constexpr size_t kPasses = 2000;
+    if (count == 0) {
+        return 2;
+    }
+
+    std::mt19937 rng(11);
+    std::uniform_real_distribution<float> angle(-4.f * kPi, 4.f * kPi);
+    std::uniform_real_distribution<float> coordinate(-5000.f, 5000.f);
+    std::uniform_real_distribution<float> pitch(-kPi / 2.f, kPi / 2.f);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+    std::printf("%zu elements, %zu passes, per element\n", count, kPasses);
+
+    // angle wrapping, as the manager does for the rotation deltas
+    {
+        std::vector<float> input(count), scalar(count), simd(count);
+        for (auto& value : input) {
+            value = angle(rng);
+        }
+        double scalarNs = Time(count, kPasses, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                scalar[i] = Scalar::NormalRelativeAngle(input[i]);
+            }
+            g_sink = scalar[count / 2];
+        });
+        double simdNs = Time(count, kPasses, [&] {
+            simd = input;
+            NormalizeAngles(simd.data(), count);
+            g_sink = simd[count / 2];
+        });
+        float maxDifference = 0.f;
+        for (size_t i = 0; i < count; ++i) {
+            maxDifference = std::max(maxDifference, std::abs(NormalizeAngle(simd[i] - scalar[i])));
+        }
+        Print("wrap angles", scalarNs, simdNs, maxDifference);
+    }
+
+    // normalize + cross + dot, the look-at and framing basis
+    {
+        std::vector<Scalar::Vec3> scalarIn(count);
+        std::vector<Vec3> simdIn(count);
+        for (size_t i = 0; i < count; ++i) {
+            scalarIn[i] = { coordinate(rng), coordinate(rng), coordinate(rng) };
+            simdIn[i] = Vec3(scalarIn[i].x, scalarIn[i].y, scalarIn[i].z);
+        }
+        std::vector<float> scalarOut(count), simdOut(count);
+        const Scalar::Vec3 scalarUp{ 0.f, 0.f, 1.f };
+        const Vec3 simdUp(0.f, 0.f, 1.f);
+        double scalarNs = Time(count, kPasses, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                auto forward = Scalar::Normalize(scalarIn[i]);
+                auto right = Scalar::Normalize(Scalar::Cross(forward, scalarUp));
+                scalarOut[i] = Scalar::Dot(Scalar::Cross(right, forward), scalarUp);
+            }
+            g_sink = scalarOut[count / 2];
+        });
+        double simdNs = Time(count, kPasses, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                auto forward = Normalize(simdIn[i]);
+                auto right = Normalize(Cross(forward, simdUp));
+                simdOut[i] = Dot(Cross(right, forward), simdUp);
+            }
+            g_sink = simdOut[count / 2];
+        });
+        float maxDifference = 0.f;
+        for (size_t i = 0; i < count; ++i) {
+            maxDifference = std::max(maxDifference, std::abs(simdOut[i] - scalarOut[i]));
+        }
+        Print("normalize/cross/dot", scalarNs, simdNs, maxDifference);
+    }
+
+    // quaternion rotation and slerp of camera rotations
+    {
+        std::vector<Scalar::Quat> scalarFrom(count), scalarTo(count);
+        std::vector<Quat> simdFrom(count), simdTo(count);
+        std::vector<float> t(count);
+        for (size_t i = 0; i < count; ++i) {
+            simdFrom[i] = Quat::FromPitchYaw({ pitch(rng), angle(rng) });
+            simdTo[i] = Quat::FromPitchYaw({ pitch(rng), angle(rng) });
+            scalarFrom[i] = { simdFrom[i].X(), simdFrom[i].Y(), simdFrom[i].Z(), simdFrom[i].W() };
+            scalarTo[i] = { simdTo[i].X(), simdTo[i].Y(), simdTo[i].Z(), simdTo[i].W() };
+            t[i] = unit(rng);
+        }
+
+        std::vector<Scalar::Vec3> scalarForward(count);
+        std::vector<Vec3> simdForward(count);
+        double scalarNs = Time(count, kPasses, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                scalarForward[i] = Scalar::Rotate(scalarFrom[i], { 0.f, 1.f, 0.f });
+            }
+            g_sink = scalarForward[count / 2].x;
+        });
+        double simdNs = Time(count, kPasses, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                simdForward[i] = simdFrom[i].Forward();
+            }
+            g_sink = simdForward[count / 2].X();
+        });
+        float maxDifference = 0.f;
+        for (size_t i = 0; i < count; ++i) {
+            auto& s = scalarForward[i];
+            maxDifference = std::max(maxDifference, Length(simdForward[i] - Vec3(s.x, s.y, s.z)));
+        }
+        Print("quaternion rotate", scalarNs, simdNs, maxDifference);
+
+        std::vector<Scalar::Quat> scalarBlend(count);
+        std::vector<Quat> simdBlend(count);
+        scalarNs = Time(count, kPasses / 4, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                scalarBlend[i] = Scalar::Slerp(scalarFrom[i], scalarTo[i], t[i]);
+            }
+            g_sink = scalarBlend[count / 2].w;
+        });
+        simdNs = Time(count, kPasses / 4, [&] {
+            for (size_t i = 0; i < count; ++i) {
+                simdBlend[i] = Slerp(simdFrom[i], simdTo[i], t[i]);
+            }
+            g_sink = simdBlend[count / 2].W();
+        });
+        maxDifference = 0.f;
+        for (size_t i = 0; i < count; ++i) {
+            auto& s = scalarBlend[i];
+            maxDifference = std::max(maxDifference, 1.f - std::abs(Dot(simdBlend[i], Quat(s.x, s.y, s.z, s.w))));
+        }
+        Print("quaternion slerp", scalarNs, simdNs, maxDifference);
+    }
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Cost of keeping the actor grid (SpatialGrid) current and of querying it, with 1000+ actors walking around
+// the player. Compares the incremental per-frame sync with a full rebuild, and the grid's cone and radius
+// queries with a linear scan over all actors. The per-frame totals contrast syncing before every query
+// (the old ActorGrid callers) with one sync per frame and queries that read the grid as it is.
+// The grid queries are checked against the linear scan every frame; exits non-zero on a mismatch.
+//   GridBench [actors] [frames] [seed]
+#include "ScreenProjection.h"
+#include "SpatialGrid.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using namespace SecondSight;
+
+namespace {
+    constexpr float kPi = 3.14159265f;
+    constexpr float kFrameTime = 1.f / 60.f;
+    constexpr float kArea = 24000.f;            // roughly the loaded cells around the player
+    constexpr float kMaxDistance = 8000.f;      // ActorGrid::kDefaultMaxDistance
+    constexpr float kConeAngle = 7.f;           // crosshair scan angle, degrees
+    constexpr float kGroupRadius = 1500.f;
+    constexpr size_t kQueriesPerFrame = 3;      // crosshair target, group members, prewarm
+
+    struct Actor {
+        SpatialGrid::ID id = 0;
+        SpatialGrid::Point position;
+        float vx = 0.f;
+        float vy = 0.f;
+    };
+
+    struct Timer {
+        double total = 0.0;
+
+        template <class F>
+        void Run(F&& a_func) {
+            auto start = std::chrono::steady_clock::now();
+            a_func();
+            total += std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+        }
+    };
+
+    struct Best {
+        SpatialGrid::ID id = 0;
+        float cosAngle = -2.f;
+        float distance = 0.f;
+
+        // ActorGrid::FindCrosshairTarget's order, with the id breaking exact ties
+        void Offer(SpatialGrid::ID a_id, float a_cosAngle, float a_distance) {
+            if (a_cosAngle > cosAngle || (a_cosAngle == cosAngle && (a_distance < distance || (a_distance == distance && a_id < id)))) {
+                id = a_id;
+                cosAngle = a_cosAngle;
+                distance = a_distance;
+            }
+        }
+    };
+
+    ScreenProjection::Query MakeQuery(const SpatialGrid::Point& a_origin, float a_yaw) {
+        ScreenProjection::Query query;
+        query.origin[0] = a_origin.x;
+        query.origin[1] = a_origin.y;
+        query.origin[2] = a_origin.z;
+        query.forward[0] = std::sin(a_yaw);
+        query.forward[1] = std::cos(a_yaw);
+        query.forward[2] = 0.f;
+        query.maxDistance = kMaxDistance;
+        query.cosMaxAngle = std::cos(kConeAngle * kPi / 180.f);
+        return query;
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t actorCount = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 2000;
+    size_t frames = a_argc > 2 ? std::strtoul(a_argv[2], nullptr, 10) : 600;
+    std::uint32_t seed = a_argc > 3 ? static_cast<std::uint32_t>(std::strtoul(a_argv[3], nullptr, 10)) : 1;
+    if (actorCount == 0 || frames == 0) {
+        return 2;
+    }
+
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<float> spread(-kArea * 0.5f, kArea * 0.5f);
+    std::uniform_real_distribution<float> speed(-300.f, 300.f);
+    std::uniform_real_distribution<float> unit(0.f, 1.f);
+
+    std::vector<Actor> actors(actorCount);
+    for (size_t i = 0; i < actorCount; ++i) {
+        actors[i] = { static_cast<SpatialGrid::ID>(0xFF000800 + i), { spread(rng), spread(rng), 0.f }, speed(rng), speed(rng) };
+    }
+    std::printf("%zu actors over %.0f x %.0f units, %zu frames, %zu queries per frame\n", actorCount, kArea, kArea, frames, kQueriesPerFrame);
+
+    SpatialGrid grid;
+    SpatialGrid rebuilt;
+    ScreenProjection::Candidates candidates, all;
+    std::vector<SpatialGrid::ID> candidateIDs;
+    ScreenProjection::Result projection;
+    std::vector<SpatialGrid::ID> gridMembers, linearMembers;
+    candidates.x.reserve(actorCount);
+    candidates.y.reserve(actorCount);
+    candidates.z.reserve(actorCount);
+    candidateIDs.reserve(actorCount);
+
+    Timer syncTimer, rebuildTimer, coneTimer, linearConeTimer, radiusTimer, linearRadiusTimer;
+    size_t mismatches = 0;
+    size_t coneCandidates = 0;
+    SpatialGrid::Point player{ 0.f, 0.f, 0.f };
+    float yaw = 0.f;
+
+    for (size_t frame = 0; frame < frames; ++frame) {
+        // everyone walks, 2% of the actors leave the process lists and are replaced by new ones
+        for (auto& actor : actors) {
+            actor.position.x += actor.vx * kFrameTime;
+            actor.position.y += actor.vy * kFrameTime;
+            if (unit(rng) < 0.02f) {
+                actor.id += static_cast<SpatialGrid::ID>(actorCount);
+                actor.position = { spread(rng), spread(rng), 0.f };
+            }
+        }
+        player.x += 200.f * kFrameTime;
+        yaw += 0.01f;
+
+        syncTimer.Run([&] {
+            grid.BeginSync();
+            for (auto& actor : actors) {
+                grid.Update(actor.id, actor.position);
+            }
+            grid.EndSync();
+        });
+        rebuildTimer.Run([&] {
+            rebuilt.Clear();
+            for (auto& actor : actors) {
+                rebuilt.Update(actor.id, actor.position);
+            }
+        });
+
+        auto query = MakeQuery(player, yaw);
+
+        // crosshair cone: grid gather + one projection batch against one batch over everyone.
+        // The check uses the scalar kernel on both sides, the AVX2 path rounds the tail differently.
+        Best gridBest, linearBest;
+        coneTimer.Run([&] {
+            candidates.Clear();
+            candidateIDs.clear();
+            grid.ForEachNearCone(player, { query.forward[0], query.forward[1], query.forward[2] }, kMaxDistance, kConeAngle,
+                [&](SpatialGrid::ID a_id, const SpatialGrid::Point& a_position) {
+                    candidates.Add(a_position.x, a_position.y, a_position.z);
+                    candidateIDs.push_back(a_id);
+                });
+            ScreenProjection::ProjectScalar(query, candidates, projection);
+            for (size_t i = 0; i < projection.count; ++i) {
+                gridBest.Offer(candidateIDs[projection.indices[i]], projection.cosAngle[i], projection.distance[i]);
+            }
+        });
+        coneCandidates += candidates.Size();
+
+        linearConeTimer.Run([&] {
+            all.Clear();
+            for (auto& actor : actors) {
+                all.Add(actor.position.x, actor.position.y, actor.position.z);
+            }
+            ScreenProjection::ProjectScalar(query, all, projection);
+            for (size_t i = 0; i < projection.count; ++i) {
+                linearBest.Offer(actors[projection.indices[i]].id, projection.cosAngle[i], projection.distance[i]);
+            }
+        });
+        if (gridBest.id != linearBest.id) {
+            ++mismatches;
+        }
+
+        // group members around the player
+        radiusTimer.Run([&] {
+            gridMembers.clear();
+            grid.ForEachInRadius(player, kGroupRadius, [&](SpatialGrid::ID a_id, const SpatialGrid::Point&) {
+                gridMembers.push_back(a_id);
+            });
+        });
+        linearRadiusTimer.Run([&] {
+            linearMembers.clear();
+            for (auto& actor : actors) {
+                float dx = actor.position.x - player.x;
+                float dy = actor.position.y - player.y;
+                float dz = actor.position.z - player.z;
+                if (dx * dx + dy * dy + dz * dz <= kGroupRadius * kGroupRadius) {
+                    linearMembers.push_back(actor.id);
+                }
+            }
+        });
+        std::sort(gridMembers.begin(), gridMembers.end());
+        std::sort(linearMembers.begin(), linearMembers.end());
+        if (gridMembers != linearMembers) {
+            ++mismatches;
+        }
+    }
+
+    auto perFrame = [&](const Timer& a_timer) { return a_timer.total * 1e6 / frames; };
+    double query = (perFrame(coneTimer) + perFrame(radiusTimer)) * 0.5;
+    std::printf("incremental sync  %8.2f us/frame\n", perFrame(syncTimer));
+    std::printf("full rebuild      %8.2f us/frame\n", perFrame(rebuildTimer));
+    std::printf("cone query        %8.2f us (grid, %.0f candidates)  %8.2f us (linear)\n", perFrame(coneTimer),
+        static_cast<double>(coneCandidates) / frames, perFrame(linearConeTimer));
+    std::printf("radius query      %8.2f us (grid)  %8.2f us (linear)\n", perFrame(radiusTimer), perFrame(linearRadiusTimer));
+    std::printf("per frame, %zu queries: sync per query %8.2f us, sync per frame %8.2f us\n", kQueriesPerFrame,
+        kQueriesPerFrame * (perFrame(syncTimer) + query), perFrame(syncTimer) + kQueriesPerFrame * query);
+    std::printf("grid vs linear: %zu mismatched queries\n", mismatches);
+    return mismatches == 0 ? 0 : 1;
+}
@@ -0,0 +1,176 @@
+// Head to head comparison of the compile-time camera policies (CameraPolicies.h) that run without the game:
+// the transition curves, scored with the autotuner's simulator, and the cost of the target chain against
+// an equivalent chain behind virtual calls. The anchor policies need actor 3D and are not covered here.
+//   PolicyBench [scenarios] [seed]
+#include "PolicyChain.h"
+#include "Simulator.h"
+#include "TransitionTiming.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <memory>
+#include <random>
+#include <vector>
+
+using namespace SecondSight;
+using namespace SecondSight::Tools;
+
+namespace {
+    volatile float g_sink;  // keeps the timed loops from being optimized away
+
+    double Seconds(std::chrono::steady_clock::duration a_duration) {
+        return std::chrono::duration<double>(a_duration).count();
+    }
+
+    template <TransitionPolicy Timing>
+    void CompareTiming(const char* a_name, const std::vector<Scenario>& a_scenarios, const Weights& a_weights) {
+        Timing timing;
+        Parameters defaults;
+
+        Score total;
+        for (auto& scenario : a_scenarios) {
+            auto score = Simulate(scenario, timing, defaults.lookAtStart, defaults.lookAtEnd, a_weights);
+            total.angularVelocity += score.angularVelocity;
+            total.jerk += score.jerk;
+            total.duration += score.duration;
+            total.visibility += score.visibility;
+            total.total += score.total;
+        }
+        float count = static_cast<float>(a_scenarios.size());
+
+        // cost of the duration lookup itself
+        constexpr size_t kCalls = 10'000'000;
+        float sink = 0.f;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < kCalls; ++i) {
+            sink += timing.Compute(static_cast<float>(i % 20000), 8000.f);
+        }
+        double ns = Seconds(std::chrono::steady_clock::now() - start) * 1e9 / kCalls;
+
+        std::printf("%-12s score %7.3f | angular %5.2f rad/s, jerk %6.1f, duration %4.2f s, visible %5.1f%% | %5.2f ns/call\n",
+            a_name, total.total / count, total.angularVelocity / count, total.jerk / count, total.duration / count,
+            total.visibility / count * 100.f, ns);
+        g_sink = sink;
+    }
+
+    // Stand-ins for the game's target sources: which mods are active is part of the query
+    struct MockQuery {
+        int explicitTarget = 0;
+        int dtrTarget = 0;      // 0 = reticle inactive
+        int tdmTarget = 0;      // 0 = no lock
+        int crosshairTarget = 0;
+    };
+
+    struct MockExplicit {
+        static bool Select(const MockQuery& a_query, int& a_out) {
+            if (!a_query.explicitTarget) {
+                return false;
+            }
+            a_out = a_query.explicitTarget;
+            return true;
+        }
+    };
+
+    struct MockDTR {
+        static bool Select(const MockQuery& a_query, int& a_out) {
+            if (!a_query.dtrTarget) {
+                return false;
+            }
+            a_out = a_query.dtrTarget;
+            return true;
+        }
+    };
+
+    struct MockTDM {
+        static bool Select(const MockQuery& a_query, int& a_out) {
+            if (!a_query.tdmTarget) {
+                return false;
+            }
+            a_out = a_query.tdmTarget;
+            return true;
+        }
+    };
+
+    struct MockCrosshair {
+        static bool Select(const MockQuery& a_query, int& a_out) {
+            a_out = a_query.crosshairTarget;
+            return true;
+        }
+    };
+
+    using StaticChain = FirstOf<MockQuery, int, MockExplicit, MockDTR, MockTDM, MockCrosshair>;
+
+    // the same chain as run-time polymorphic links, what the policies replace
+    struct VirtualSource {
+        virtual ~VirtualSource() = default;
+        virtual bool Select(const MockQuery& a_query, int& a_out) const = 0;
+    };
+
+    template <class Source>
+    struct VirtualAdapter : VirtualSource {
+        bool Select(const MockQuery& a_query, int& a_out) const override { return Source::Select(a_query, a_out); }
+    };
+
+    struct VirtualChain {
+        std::vector<std::unique_ptr<VirtualSource>> sources;
+
+        int Select(const MockQuery& a_query) const {
+            int result = 0;
+            for (auto& source : sources) {
+                if (source->Select(a_query, result)) {
+                    break;
+                }
+            }
+            return result;
+        }
+    };
+
+    template <class F>
+    void TimeChain(const char* a_name, const std::vector<MockQuery>& a_queries, size_t a_passes, F&& a_select) {
+        long long sink = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < a_passes; ++pass) {
+            for (auto& query : a_queries) {
+                sink += a_select(query);
+            }
+        }
+        double ns = Seconds(std::chrono::steady_clock::now() - start) * 1e9 / (a_queries.size() * a_passes);
+        std::printf("%-12s %5.2f ns/select (checksum %lld)\n", a_name, ns, sink);
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t scenarioCount = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 256;
+    std::uint32_t seed = a_argc > 2 ? static_cast<std::uint32_t>(std::strtoul(a_argv[2], nullptr, 10)) : 1;
+
+    auto scenarios = GenerateScenarios(scenarioCount, seed);
+    Weights weights;
+    std::printf("Transition curves, %zu scenarios, default [Transition] settings\n", scenarios.size());
+    CompareTiming<BasicTransitionTiming<LinearCurve>>("linear", scenarios, weights);
+    CompareTiming<BasicTransitionTiming<SmoothstepCurve>>("smoothstep", scenarios, weights);
+    CompareTiming<BasicTransitionTiming<SqrtCurve>>("sqrt", scenarios, weights);
+
+    // mods toggling at random, so neither chain gets a perfectly predicted branch
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> pick(0, 3);
+    std::vector<MockQuery> queries(4096);
+    for (auto& query : queries) {
+        query.explicitTarget = pick(rng) == 0 ? 1 : 0;
+        query.dtrTarget = pick(rng) == 0 ? 2 : 0;
+        query.tdmTarget = pick(rng) == 0 ? 3 : 0;
+        query.crosshairTarget = pick(rng) == 0 ? 0 : 4;
+    }
+
+    VirtualChain virtualChain;
+    virtualChain.sources.push_back(std::make_unique<VirtualAdapter<MockExplicit>>());
+    virtualChain.sources.push_back(std::make_unique<VirtualAdapter<MockDTR>>());
+    virtualChain.sources.push_back(std::make_unique<VirtualAdapter<MockTDM>>());
+    virtualChain.sources.push_back(std::make_unique<VirtualAdapter<MockCrosshair>>());
+
+    constexpr size_t kPasses = 5000;
+    std::printf("Target chain, explicit -> DTR -> TDM -> crosshair\n");
+    TimeChain("policies", queries, kPasses, [](const MockQuery& a_query) { return StaticChain::Select(a_query); });
+    TimeChain("virtual", queries, kPasses, [&](const MockQuery& a_query) { return virtualChain.Select(a_query); });
+    return 0;
+}
@@ -0,0 +1,123 @@
+// Throughput of the batched candidate projection (ScreenProjection), scalar against AVX2, on random
+// points around a camera with an 80 degree horizontal field of view.
+//   ProjectionBench [points] [cone angle, degrees]
+#include "CameraMath.h"
+#include "ScreenProjection.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+
+using namespace SecondSight;
+using namespace SecondSight::ScreenProjection;
+
+namespace {
+    double Seconds(std::chrono::steady_clock::duration a_duration) {
+        return std::chrono::duration<double>(a_duration).count();
+    }
+
+    // perspective world to clip matrix for a camera at a_position looking along pitch/yaw
+    Camera MakeCamera(const CameraMath::Vec3& a_position, float a_pitch, float a_yaw, float a_horizontalFov, float a_aspect) {
+        auto forward = CameraMath::ForwardFromPitchYaw(a_pitch, a_yaw);
+        auto right = CameraMath::Normalize(CameraMath::Vec3(std::cos(a_yaw), -std::sin(a_yaw), 0.f));
+        auto up = CameraMath::Cross(right, forward);
+
+        float sx = 1.f / std::tan(a_horizontalFov * 0.5f);
+        float sy = sx * a_aspect;
+        const CameraMath::Vec3 rows[3] = { right * sx, up * sy, forward };
+        const int rowIndices[3] = { 0, 1, 3 };
+
+        Camera camera;
+        for (int r = 0; r < 3; ++r) {
+            auto& row = camera.worldToCam[rowIndices[r]];
+            row[0] = rows[r].X();
+            row[1] = rows[r].Y();
+            row[2] = rows[r].Z();
+            row[3] = -CameraMath::Dot(rows[r], a_position);
+        }
+        camera.worldToCam[2][2] = 1.f;  // depth is not used
+        return camera;
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t count = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 10000;
+    float coneAngle = a_argc > 2 ? std::strtof(a_argv[2], nullptr) : 7.f;
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> spread(-8000.f, 8000.f);
+    std::uniform_real_distribution<float> height(-500.f, 500.f);
+    Candidates candidates;
+    for (size_t i = 0; i < count; ++i) {
+        candidates.Add(spread(rng), spread(rng), height(rng));
+    }
+
+    CameraMath::Vec3 position(100.f, -200.f, 150.f);
+    float pitch = 0.05f, yaw = 0.7f;
+    auto camera = MakeCamera(position, pitch, yaw, 80.f * CameraMath::kPi / 180.f, 16.f / 9.f);
+    auto forward = CameraMath::ForwardFromPitchYaw(pitch, yaw);
+
+    Query query;
+    query.camera = &camera;
+    query.origin[0] = position.X();
+    query.origin[1] = position.Y();
+    query.origin[2] = position.Z();
+    query.forward[0] = forward.X();
+    query.forward[1] = forward.Y();
+    query.forward[2] = forward.Z();
+    query.maxDistance = 8000.f;
+    query.cosMaxAngle = std::cos(coneAngle * CameraMath::kPi / 180.f);
+
+    bool hasAVX2 = HasAVX2();
+    std::printf("%zu points, %.1f degree cone, AVX2 %s\n", count, coneAngle, hasAVX2 ? "available" : "not available");
+
+    Result scalar, avx2;
+    constexpr size_t kPasses = 2000;
+    auto run = [&](const char* a_name, auto&& a_kernel, Result& a_result) {
+        a_kernel(query, candidates, a_result);
+        auto start = std::chrono::steady_clock::now();
+        for (size_t pass = 0; pass < kPasses; ++pass) {
+            a_kernel(query, candidates, a_result);
+        }
+        double us = Seconds(std::chrono::steady_clock::now() - start) * 1e6 / kPasses;
+        std::printf("%-8s %8.2f us/batch, %5.2f ns/point, %zu survivors\n", a_name, us, us * 1000.0 / count, a_result.count);
+    };
+
+    // the screen test alone, without the cone
+    Query screenOnly = query;
+    screenOnly.cosMaxAngle = -1.f;
+    Result onScreen;
+    ProjectScalar(screenOnly, candidates, onScreen);
+    std::printf("on screen: %zu of %zu\n", onScreen.count, count);
+
+    run("scalar", ProjectScalar, scalar);
+    if (!hasAVX2) {
+        return 0;
+    }
+    run("avx2", ProjectAVX2, avx2);
+
+    // FMA rounding may move points lying exactly on an edge, everything else has to agree
+    size_t mismatches = 0;
+    float maxError = 0.f;
+    size_t s = 0, a = 0;
+    while (s < scalar.count && a < avx2.count) {
+        if (scalar.indices[s] == avx2.indices[a]) {
+            maxError = std::max({ maxError, std::abs(scalar.screenX[s] - avx2.screenX[a]), std::abs(scalar.screenY[s] - avx2.screenY[a]),
+                std::abs(scalar.cosAngle[s] - avx2.cosAngle[a]) });
+            ++s;
+            ++a;
+        } else if (scalar.indices[s] < avx2.indices[a]) {
+            ++s;
+            ++mismatches;
+        } else {
+            ++a;
+            ++mismatches;
+        }
+    }
+    mismatches += (scalar.count - s) + (avx2.count - a);
+    std::printf("scalar vs avx2: %zu mismatched survivors, max difference %g\n", mismatches, maxError);
+    return 0;
+}
@@ -0,0 +1,116 @@
+// Compression ratio and encode/decode throughput of RewindBuffer on synthetic actor paths.
+//   RewindBench [actors] [seconds]
+#include "RewindBuffer.h"
+
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <random>
+#include <vector>
+
+using SecondSight::RewindBuffer;
+
+namespace {
+    constexpr float kSampleInterval = 0.1f;
+
+    // wandering walk/run with occasional stops and teleports
+    struct Walker {
+        float x, y, z, heading, speed;
+
+        void Step(std::mt19937& a_rng, float a_dt) {
+            std::uniform_real_distribution<float> unit(0.f, 1.f);
+            heading += (unit(a_rng) - 0.5f) * 1.5f * a_dt;
+            if (unit(a_rng) < 0.02f) {
+                speed = unit(a_rng) < 0.3f ? 0.f : 80.f + unit(a_rng) * 420.f;
+            }
+            if (unit(a_rng) < 0.0005f) {
+                x += 20000.f;
+            }
+            x += std::sin(heading) * speed * a_dt;
+            y += std::cos(heading) * speed * a_dt;
+            z += std::sin(x * 0.001f) * 2.f * a_dt * speed * 0.1f;
+        }
+    };
+
+    double Seconds(std::chrono::steady_clock::duration a_duration) {
+        return std::chrono::duration<double>(a_duration).count();
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t actors = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 48;
+    float duration = a_argc > 2 ? std::strtof(a_argv[2], nullptr) : 600.f;
+    size_t steps = static_cast<size_t>(duration / kSampleInterval);
+
+    std::mt19937 rng(1234);
+    std::uniform_real_distribution<float> spread(-50000.f, 50000.f);
+    std::vector<Walker> walkers(actors);
+    for (auto& walker : walkers) {
+        walker = { spread(rng), spread(rng), spread(rng) * 0.05f, 0.f, 120.f };
+    }
+
+    // pre-generate the input so only the encoder is timed
+    std::vector<RewindBuffer::Sample> input(steps * actors);
+    for (size_t step = 0; step < steps; ++step) {
+        for (size_t i = 0; i < actors; ++i) {
+            walkers[i].Step(rng, kSampleInterval);
+            auto& sample = input[step * actors + i];
+            sample = { step * kSampleInterval, walkers[i].x, walkers[i].y, walkers[i].z, std::remainder(walkers[i].heading, 6.2831853f) };
+        }
+    }
+
+    RewindBuffer::Settings settings;
+    settings.trackCount = std::max<size_t>(actors, 1);
+    RewindBuffer buffer(settings);
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t step = 0; step < steps; ++step) {
+        for (size_t i = 0; i < actors; ++i) {
+            buffer.Record(static_cast<RewindBuffer::TrackID>(i + 1), input[step * actors + i]);
+        }
+    }
+    double encodeTime = Seconds(std::chrono::steady_clock::now() - start);
+
+    // decode the full history of every track, and check it against the input
+    std::vector<RewindBuffer::Sample> decoded;
+    decoded.reserve(steps);
+    size_t decodedCount = 0;
+    double maxPositionError = 0.0;
+    double maxHeadingError = 0.0;
+    double decodeTime = 0.0;
+    for (size_t i = 0; i < actors; ++i) {
+        decoded.clear();
+        start = std::chrono::steady_clock::now();
+        buffer.Decode(static_cast<RewindBuffer::TrackID>(i + 1), 0.f, duration, decoded);
+        decodeTime += Seconds(std::chrono::steady_clock::now() - start);
+        decodedCount += decoded.size();
+
+        size_t offset = steps - decoded.size();
+        for (size_t j = 0; j < decoded.size(); ++j) {
+            auto& in = input[(offset + j) * actors + i];
+            auto& out = decoded[j];
+            maxPositionError = std::max<double>(maxPositionError, std::abs(in.x - out.x));
+            maxPositionError = std::max<double>(maxPositionError, std::abs(in.y - out.y));
+            maxPositionError = std::max<double>(maxPositionError, std::abs(in.z - out.z));
+            maxHeadingError = std::max<double>(maxHeadingError, std::abs(std::remainder(in.heading - out.heading, 6.2831853f)));
+        }
+    }
+
+    size_t samples = buffer.GetSampleCount();
+    size_t encodedBytes = buffer.GetEncodedBytes();
+    float oldest = 0.f, newest = 0.f;
+    buffer.GetTimeRange(1, oldest, newest);
+
+    std::printf("actors %zu, %zu samples each, %.0f Hz\n", actors, steps, 1.f / kSampleInterval);
+    std::printf("memory          %zu bytes (fixed)\n", buffer.GetMemoryUsage());
+    std::printf("retained        %zu samples, %.1f s of history per track\n", samples, newest - oldest);
+    std::printf("compression     %.2f bytes/sample, ratio %.2f vs raw floats\n",
+        static_cast<double>(encodedBytes) / samples, static_cast<double>(samples * sizeof(RewindBuffer::Sample)) / encodedBytes);
+    std::printf("encode          %.1f ns/sample, %.2f us per frame for %zu actors\n",
+        encodeTime * 1e9 / (steps * actors), encodeTime * 1e6 / steps, actors);
+    std::printf("decode          %.1f ns/sample\n", decodeTime * 1e9 / std::max<size_t>(decodedCount, 1));
+    std::printf("max error       %.3f units, %.5f rad\n", maxPositionError, maxHeadingError);
+
+    return maxPositionError <= RewindBuffer::kPositionStep ? 0 : 1;
+}
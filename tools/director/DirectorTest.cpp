@@ -0,0 +1,167 @@
+// Checks DirectorQueue against synthetic event streams: minimum dwell, cooldown after a cut, the switch
+// ratio, score decay (including across a rebase of the time epoch), removal, and that the heap stays
+// proportional to the number of candidates under a long stream of events.
+// Exits non-zero if any check fails.
+#include "DirectorQueue.h"
+
+#include <cmath>
+#include <cstdio>
+#include <random>
+
+using namespace SecondSight;
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    bool Near(float a_value, float a_expected, float a_tolerance = 1e-3f) {
+        return std::abs(a_value - a_expected) <= a_tolerance * std::max(1.f, std::abs(a_expected));
+    }
+
+    void TestDwell() {
+        DirectorQueue::Settings settings;
+        DirectorQueue queue(settings);
+        queue.AddScore(1, 2.f, 0.f);
+        queue.AddScore(2, 20.f, 1.f);
+
+        Check(!queue.SelectCut(1, 0.f, settings.minDwell - 0.1f), "dwell: no cut before minDwell");
+        auto cut = queue.SelectCut(1, 0.f, settings.minDwell + 0.1f);
+        Check(cut && *cut == 2, "dwell: cut to the stronger candidate after minDwell");
+
+        // without a current target there is nothing to dwell on
+        auto first = queue.SelectCut(0, 0.f, 0.5f);
+        Check(first && *first == 2, "dwell: first cut is immediate");
+    }
+
+    void TestCooldown() {
+        DirectorQueue::Settings settings;
+        DirectorQueue queue(settings);
+        queue.AddScore(1, 10.f, 0.f);
+        queue.AddScore(2, 8.f, 0.f);
+        queue.OnCut(1, 2, 0.f);
+
+        // 1 stays well above 2, but was just left
+        float time = settings.minDwell + 1.f;
+        queue.AddScore(1, 30.f, time);
+        Check(!queue.SelectCut(2, 0.f, time), "cooldown: no cut back during the cooldown");
+
+        time = settings.cooldown + 0.1f;
+        queue.AddScore(1, 30.f, time);
+        auto cut = queue.SelectCut(2, 0.f, time);
+        Check(cut && *cut == 1, "cooldown: cut back once the cooldown has passed");
+
+        // a failed cut puts the candidate on cooldown as well
+        queue.SetCooldown(1, time);
+        Check(!queue.SelectCut(2, 0.f, time), "cooldown: SetCooldown blocks the candidate");
+    }
+
+    void TestSwitchRatio() {
+        DirectorQueue::Settings settings;
+        float time = settings.minDwell + 1.f;
+
+        DirectorQueue below(settings);
+        below.AddScore(1, 10.f, time);
+        below.AddScore(2, 10.f * settings.switchRatio * 0.95f, time);
+        Check(!below.SelectCut(1, 0.f, time), "switch ratio: no cut below the ratio");
+
+        DirectorQueue above(settings);
+        above.AddScore(1, 10.f, time);
+        above.AddScore(2, 10.f * settings.switchRatio * 1.05f, time);
+        auto cut = above.SelectCut(1, 0.f, time);
+        Check(cut && *cut == 2, "switch ratio: cut above the ratio");
+    }
+
+    void TestDecay() {
+        DirectorQueue::Settings settings;
+        DirectorQueue queue(settings);
+        queue.AddScore(1, 8.f, 10.f);
+        Check(Near(queue.GetScore(1, 10.f), 8.f), "decay: score at the event");
+        Check(Near(queue.GetScore(1, 10.f + settings.halfLife), 4.f), "decay: halved after one half-life");
+        Check(Near(queue.GetScore(1, 10.f + 3.f * settings.halfLife), 1.f), "decay: an eighth after three half-lives");
+
+        // scores add up at the time of the event
+        queue.AddScore(1, 4.f, 10.f + settings.halfLife);
+        Check(Near(queue.GetScore(1, 10.f + settings.halfLife), 8.f), "decay: weights add to the decayed score");
+
+        // faded candidates are not picked
+        Check(!queue.SelectCut(0, 0.f, 10.f + 20.f * settings.halfLife), "decay: no cut to a faded candidate");
+
+        // far beyond the rebase threshold (200 tau) the scores and their order survive
+        float late = 5000.f;
+        queue.AddScore(2, 6.f, late);
+        queue.AddScore(3, 9.f, late);
+        Check(Near(queue.GetScore(3, late + settings.halfLife), 4.5f), "decay: correct after a rebase");
+        auto cut = queue.SelectCut(0, 0.f, late);
+        Check(cut && *cut == 3, "decay: order kept across a rebase");
+    }
+
+    void TestRemove() {
+        DirectorQueue queue;
+        queue.AddScore(1, 10.f, 0.f);
+        queue.AddScore(2, 5.f, 0.f);
+        queue.Remove(1);
+        auto cut = queue.SelectCut(0, 0.f, 0.f);
+        Check(cut && *cut == 2, "remove: removed candidate is skipped");
+
+        // a candidate re-added before its old entries were dropped starts over, they must not come back
+        queue.AddScore(3, 10.f, 0.f);
+        queue.Remove(3);
+        queue.AddScore(3, 1.f, 0.f);
+        Check(Near(queue.GetScore(3, 0.f), 1.f), "remove: re-added candidate starts from zero");
+        cut = queue.SelectCut(0, 0.f, 0.f);
+        Check(cut && *cut == 2, "remove: re-added candidate ranked by its new score");
+    }
+
+    void TestHeapBound() {
+        DirectorQueue::Settings settings;
+        DirectorQueue queue(settings);
+        std::mt19937 rng(7);
+        std::uniform_int_distribution<DirectorQueue::CandidateID> pick(1, 12);
+        std::uniform_int_distribution<int> type(0, 3);
+
+        // a long fight: 20 events per second for 20 minutes, cuts every few seconds
+        size_t maxHeap = 0;
+        size_t maxCandidates = 0;
+        DirectorQueue::CandidateID current = 0;
+        float lastCut = 0.f;
+        for (int i = 0; i < 24000; ++i) {
+            float time = i * 0.05f;
+            auto id = pick(rng);
+            queue.AddScore(id, DirectorQueue::GetEventWeight(static_cast<DirectorQueue::EventType>(type(rng))), time);
+            if (i % 7 == 0 && id % 5 == 0) {
+                queue.Remove(id);
+            }
+            if (auto cut = queue.SelectCut(current, lastCut, time)) {
+                queue.OnCut(current, *cut, time);
+                current = *cut;
+                lastCut = time;
+            }
+            maxHeap = std::max(maxHeap, queue.GetHeapSize());
+            maxCandidates = std::max(maxCandidates, queue.GetCandidateCount());
+        }
+        std::printf("heap: max %zu entries for max %zu candidates over 24000 events\n", maxHeap, maxCandidates);
+        Check(maxHeap <= 2 * maxCandidates + 1, "heap: stays within twice the candidates");
+    }
+}
+
+int main() {
+    TestDwell();
+    TestCooldown();
+    TestSwitchRatio();
+    TestDecay();
+    TestRemove();
+    TestHeapBound();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
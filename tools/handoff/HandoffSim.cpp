@@ -0,0 +1,226 @@
+// Headless run of the handoff from the transition to the at-target timeline, on the plugin's own code: the
+// built-in camera driver's PlaybackClock advances the timelines and raises the playback events, and the
+// manager's TransitionHandoff decides the switch in the kPlaybackWait handler and counts held frames in its
+// update. The glue mirrors the FreeCameraState hook: driver update, then manager update, with kPlaybackWait
+// handled inside the driver update (built-in driver) or after one or more camera updates (SKSE messaging).
+// Each cast checks the held frames TransitionHandoff measures against the frames the driver actually held
+// the end pose, that the arrival is reported once, and that an armed handoff never holds and carries the
+// time past the end into the at-target timeline.
+// Exits non-zero if a check fails.
+//   HandoffSim [casts] [seed]
+#include "PlaybackClock.h"
+#include "TransitionHandoff.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <random>
+
+using namespace SecondSight;
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    constexpr size_t kTransitionID = 1;
+    constexpr size_t kAtTargetID = 2;
+    constexpr float kAtTargetDuration = 60.f;  // tracks the target for longer than a cast runs
+    constexpr float kFrameTime = 1.f / 60.f;
+
+    struct Setup {
+        const char* name;
+        bool isArmed;               // FreeCameraManager::ArmHandoff succeeded (built-in driver)
+        size_t deliveryDelay;       // camera updates before kPlaybackWait is handled, 0 = inside the driver update
+    };
+
+    struct Stats {
+        size_t casts = 0;
+        size_t heldFrames = 0;          // measured by TransitionHandoff
+        size_t maxHeldFrames = 0;
+        size_t mismatches = 0;          // measured != held by the driver
+        size_t badArrivals = 0;         // kArrivedAtTarget not reported exactly once
+        float maxTrackingLag = 0.f;     // seconds of at-target playback lost at the switch
+    };
+
+    void SimulateCast(const Setup& a_setup, std::mt19937& a_rng, Stats& a_stats) {
+        std::uniform_real_distribution<float> unit(0.f, 1.f);
+        float duration = 0.5f + unit(a_rng) * 1.5f;
+
+        PlaybackClock clock;
+        clock.timelineID = kTransitionID;
+        TransitionHandoff handoff;
+        bool isArmed = a_setup.isArmed && clock.Arm(kAtTargetID);
+        handoff.Begin(duration, isArmed);
+
+        std::deque<size_t> pendingWaits;    // camera updates left until each queued kPlaybackWait is handled
+        size_t arrivals = 0;
+        size_t drivenHeld = 0;
+        bool isMeasured = false;
+        float time = 0.f;       // since the cast
+
+        // FreeCameraManager::SwitchToAtTarget
+        auto onPlaybackWait = [&]() {
+            switch (handoff.OnPlaybackWait(clock.timelineID == kTransitionID)) {
+            case TransitionHandoff::Action::kSwitch:
+                clock.Switch(kAtTargetID);
+                ++arrivals;
+                break;
+            case TransitionHandoff::Action::kArrive:
+                ++arrivals;
+                break;
+            default:
+                break;
+            }
+        };
+
+        for (size_t frame = 0; frame < 1000; ++frame) {
+            // frame times jitter around 60 Hz with the occasional hitch
+            float delta = kFrameTime * (0.7f + unit(a_rng) * 0.6f) * (unit(a_rng) < 0.03f ? 3.f : 1.f);
+            time += delta;
+
+            // NativeCameraDriver::Update, the events are sent for the timeline that was playing
+            size_t timelineID = clock.timelineID;
+            if (timelineID == kTransitionID && clock.isWaiting) {
+                // the end was reached in an earlier frame, the camera shows the end pose again
+                ++drivenHeld;
+            }
+            auto event = clock.Advance(delta, timelineID == kTransitionID ? duration : kAtTargetDuration, PlaybackClock::Mode::kWait);
+            if (event == PlaybackClock::Event::kSwitched) {
+                Check(isArmed, "switched without being armed");
+            }
+            bool isWait = event == PlaybackClock::Event::kWaitReached || event == PlaybackClock::Event::kSwitched;
+            if (isWait && timelineID == kTransitionID) {
+                if (a_setup.deliveryDelay == 0) {
+                    onPlaybackWait();
+                } else {
+                    pendingWaits.push_back(a_setup.deliveryDelay);
+                }
+            }
+
+            // FreeCameraManager::Update
+            if (clock.timelineID == kTransitionID) {
+                handoff.OnTransitionFrame(delta);
+            } else if (auto held = handoff.OnAtTargetFrame()) {
+                isMeasured = true;
+                // the at-target timeline should have played everything since the transition's end
+                float lag = (time - duration) - clock.time;
+                a_stats.maxTrackingLag = std::max(a_stats.maxTrackingLag, lag);
+                a_stats.heldFrames += *held;
+                a_stats.maxHeldFrames = std::max<size_t>(a_stats.maxHeldFrames, *held);
+                if (*held != drivenHeld) {
+                    ++a_stats.mismatches;
+                }
+            }
+
+            // queued messages, after the camera update
+            for (auto& wait : pendingWaits) {
+                --wait;
+            }
+            while (!pendingWaits.empty() && pendingWaits.front() == 0) {
+                pendingWaits.pop_front();
+                onPlaybackWait();
+            }
+
+            if (isMeasured && pendingWaits.empty()) {
+                break;
+            }
+        }
+
+        ++a_stats.casts;
+        if (arrivals != 1) {
+            ++a_stats.badArrivals;
+        }
+    }
+
+    Stats Run(const Setup& a_setup, size_t a_casts, std::uint32_t a_seed) {
+        std::mt19937 rng(a_seed);
+        Stats stats;
+        for (size_t i = 0; i < a_casts; ++i) {
+            SimulateCast(a_setup, rng, stats);
+        }
+        std::printf("%-28s held %.2f frames/cast (max %zu), measurement mismatches %zu, tracking lag max %5.2f ms\n",
+            a_setup.name, static_cast<double>(stats.heldFrames) / stats.casts, stats.maxHeldFrames, stats.mismatches, stats.maxTrackingLag * 1000.f);
+        Check(stats.casts > 0 && stats.mismatches == 0, "measured held frames differ from the frames the driver held");
+        Check(stats.badArrivals == 0, "arrival not reported exactly once");
+        // the camera update between the end and the handled kPlaybackWait already drove the end pose
+        size_t expectedHeld = a_setup.isArmed ? 0 : std::max<size_t>(a_setup.deliveryDelay, 1) - 1;
+        Check(stats.heldFrames == expectedHeld * stats.casts, "held frames differ from the delivery delay");
+        return stats;
+    }
+
+    void TestClock() {
+        PlaybackClock clock;
+        Check(!clock.Arm(kAtTargetID), "arming without a playback fails");
+
+        clock.timelineID = kTransitionID;
+        Check(clock.Advance(0.6f, 1.f, PlaybackClock::Mode::kWait) == PlaybackClock::Event::kNone, "no event before the end");
+        Check(clock.Advance(0.6f, 1.f, PlaybackClock::Mode::kWait) == PlaybackClock::Event::kWaitReached, "kWait reports the end");
+        Check(clock.time == 1.f && clock.isWaiting, "kWait holds at the end");
+        Check(clock.Advance(0.6f, 1.f, PlaybackClock::Mode::kWait) == PlaybackClock::Event::kNone, "kWait reports the end once");
+        Check(!clock.Arm(kAtTargetID), "arming after the end fails");
+
+        clock = PlaybackClock();
+        clock.timelineID = kTransitionID;
+        clock.speed = 2.f;
+        Check(clock.Arm(kAtTargetID), "arming a playback");
+        Check(clock.Advance(0.6f, 1.f, PlaybackClock::Mode::kWait) == PlaybackClock::Event::kSwitched, "armed kWait switches at the end");
+        Check(clock.timelineID == kAtTargetID && clock.armedTimelineID == 0, "armed timeline takes over");
+        Check(std::abs(clock.time - 0.2f) < 1e-6f && clock.speed == 2.f, "time past the end carries over at the same speed");
+
+        clock.Switch(kTransitionID);
+        Check(clock.timelineID == kTransitionID && clock.time == 0.f && clock.speed == 2.f, "switch restarts at the same speed");
+
+        clock = PlaybackClock();
+        clock.timelineID = kTransitionID;
+        Check(clock.Advance(1.5f, 1.f, PlaybackClock::Mode::kEnd) == PlaybackClock::Event::kFinished && clock.time == 1.f, "kEnd finishes");
+        clock = PlaybackClock();
+        clock.timelineID = kTransitionID;
+        Check(clock.Advance(1.25f, 1.f, PlaybackClock::Mode::kLoop, 0.5f) == PlaybackClock::Event::kNone && std::abs(clock.time - 0.75f) < 1e-6f, "kLoop wraps to the loop offset");
+        clock.isPaused = true;
+        (void)clock.Advance(0.1f, 1.f, PlaybackClock::Mode::kLoop);
+        Check(std::abs(clock.time - 0.75f) < 1e-6f, "paused clock holds");
+
+        TransitionHandoff handoff;
+        Check(handoff.OnPlaybackWait(true) == TransitionHandoff::Action::kNone, "no handoff before the transition started");
+        Check(!handoff.OnAtTargetFrame(), "nothing measured before the transition started");
+        handoff.Begin(1.f, false);
+        Check(handoff.OnPlaybackWait(false) == TransitionHandoff::Action::kNone, "unarmed handoff after leaving the transition");
+        Check(handoff.OnPlaybackWait(true) == TransitionHandoff::Action::kSwitch, "unarmed handoff switches");
+        Check(handoff.OnPlaybackWait(true) == TransitionHandoff::Action::kNone, "switches once");
+    }
+}
+
+int main(int a_argc, char** a_argv) {
+    size_t casts = a_argc > 1 ? std::strtoul(a_argv[1], nullptr, 10) : 10000;
+    std::uint32_t seed = a_argc > 2 ? static_cast<std::uint32_t>(std::strtoul(a_argv[2], nullptr, 10)) : 1;
+    if (casts == 0) {
+        return 2;
+    }
+
+    TestClock();
+
+    std::printf("%zu casts, 60 Hz with jitter and hitches\n", casts);
+    auto armed = Run({ "armed (built-in driver)", true, 0 }, casts, seed);
+    Run({ "kPlaybackWait in the driver", false, 0 }, casts, seed);
+    Run({ "kPlaybackWait after 1 update", false, 1 }, casts, seed);
+    Run({ "kPlaybackWait after 2 updates", false, 2 }, casts, seed);
+    Run({ "kPlaybackWait after 3 updates", false, 3 }, casts, seed);
+
+    // unarmed, the at-target timeline starts over and the part of the frame beyond the end is lost
+    Check(armed.maxTrackingLag < 1e-4f, "armed handoff dropped the time past the end");
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d check(s) failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
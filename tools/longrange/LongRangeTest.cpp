@@ -0,0 +1,171 @@
+// Checks LongRange::BuildPlan on the flights the manager plans: the stage count for the distance, that the
+// last stage lands on the destination, the arc over the straight line, and the timing (stages back to back,
+// constant speed along the path, ending at the duration), plus Plan::GetStage at the stage boundaries.
+// Exits non-zero if any check fails.
+#include "LongRangePlanner.h"
+
+#include <cmath>
+#include <cstdio>
+
+using namespace SecondSight;
+using namespace SecondSight::CameraMath;
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    bool Near(float a_value, float a_expected, float a_tolerance = 1e-3f) {
+        return std::abs(a_value - a_expected) <= a_tolerance * std::max(1.f, std::abs(a_expected));
+    }
+
+    bool IsFinite(const LongRange::Plan& a_plan) {
+        for (size_t i = 0; i < a_plan.stageCount; ++i) {
+            auto& stage = a_plan.stages[i];
+            if (!std::isfinite(stage.end.X()) || !std::isfinite(stage.end.Y()) || !std::isfinite(stage.end.Z()) ||
+                !std::isfinite(stage.startTime) || !std::isfinite(stage.endTime)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    // the timing every plan must have: back to back from 0 to the duration, at one speed along the path
+    void CheckTiming(const LongRange::Plan& a_plan, const Vec3& a_from, const char* a_what) {
+        bool isContiguous = Near(a_plan.stages[0].startTime, 0.f) && Near(a_plan.stages[a_plan.stageCount - 1].endTime, a_plan.duration);
+        bool isConstantSpeed = true;
+        float pathLength = 0.f;
+        Vec3 previous = a_from;
+        for (size_t i = 0; i < a_plan.stageCount; ++i) {
+            pathLength += Length(a_plan.stages[i].end - previous);
+            previous = a_plan.stages[i].end;
+        }
+        previous = a_from;
+        for (size_t i = 0; i < a_plan.stageCount; ++i) {
+            auto& stage = a_plan.stages[i];
+            if (i > 0) {
+                isContiguous = isContiguous && stage.startTime == a_plan.stages[i - 1].endTime;
+            }
+            isContiguous = isContiguous && stage.endTime >= stage.startTime;
+            if (pathLength > 0.f) {
+                float share = Length(stage.end - previous) / pathLength;
+                isConstantSpeed = isConstantSpeed && Near(stage.endTime - stage.startTime, share * a_plan.duration, 1e-3f);
+            }
+            previous = stage.end;
+        }
+
+        char what[160];
+        std::snprintf(what, sizeof(what), "%s: stages back to back from 0 to the duration", a_what);
+        Check(isContiguous, what);
+        std::snprintf(what, sizeof(what), "%s: time per stage proportional to its length", a_what);
+        Check(isConstantSpeed, what);
+        std::snprintf(what, sizeof(what), "%s: finite", a_what);
+        Check(IsFinite(a_plan), what);
+    }
+
+    void TestStageCount() {
+        LongRange::Settings settings;
+        Vec3 from(1000.f, -2000.f, 300.f);
+
+        // just past the regular range: one stage straight to the destination
+        Vec3 near = from + Vec3(4000.f, 0.f, 0.f);
+        auto single = LongRange::BuildPlan(from, near, 3.f, settings);
+        Check(single.stageCount == 1, "stages: a flight shorter than a stage is one stage");
+        Check(Length(single.stages[0].end - near) == 0.f, "stages: the single stage ends at the destination");
+        CheckTiming(single, from, "single stage");
+
+        // across a hold: ceil(distance / stageLength)
+        Vec3 far = from + Vec3(20000.f, 15000.f, 500.f);
+        float distance = Length(far - from);
+        auto plan = LongRange::BuildPlan(from, far, 9.f, settings);
+        Check(plan.stageCount == static_cast<size_t>(std::ceil(distance / settings.stageLength)), "stages: one stage per stageLength");
+        Check(Length(plan.stages[plan.stageCount - 1].end - far) == 0.f, "stages: the last stage ends at the destination");
+        CheckTiming(plan, from, "multi stage");
+
+        // across the map: capped
+        auto capped = LongRange::BuildPlan(from, from + Vec3(200000.f, 0.f, 0.f), 20.f, settings);
+        Check(capped.stageCount == LongRange::kMaxStages, "stages: capped at kMaxStages");
+        CheckTiming(capped, from, "capped");
+    }
+
+    void TestArc() {
+        LongRange::Settings settings;
+        Vec3 from(0.f, 0.f, 0.f);
+        Vec3 to(30000.f, 0.f, -1000.f);
+        auto plan = LongRange::BuildPlan(from, to, 10.f, settings);
+        float distance = Length(to - from);
+        float arcHeight = std::min(distance * settings.arcHeightRatio, settings.maxArcHeight);
+
+        // waypoints sit on the sine arc above the straight line, evenly spaced along it
+        bool isOnArc = true;
+        float apex = 0.f;
+        for (size_t i = 0; i + 1 < plan.stageCount; ++i) {
+            float t = static_cast<float>(i + 1) / static_cast<float>(plan.stageCount);
+            Vec3 line = Lerp(from, to, t);
+            float height = plan.stages[i].end.Z() - line.Z();
+            isOnArc = isOnArc && Near(plan.stages[i].end.X(), line.X()) && Near(plan.stages[i].end.Y(), line.Y()) &&
+                      Near(height, arcHeight * std::sin(kPi * t), 1e-2f);
+            apex = std::max(apex, height);
+        }
+        Check(isOnArc, "arc: waypoints on the arc above the straight line");
+        Check(apex > 0.f && apex <= settings.maxArcHeight + 1e-2f, "arc: rises, no higher than maxArcHeight");
+
+        // a short hop barely rises
+        auto hop = LongRange::BuildPlan(from, Vec3(7000.f, 0.f, 0.f), 4.f, settings);
+        Check(hop.stageCount == 2 && Near(hop.stages[0].end.Z(), 7000.f * settings.arcHeightRatio), "arc: height follows arcHeightRatio below the cap");
+    }
+
+    void TestGetStage() {
+        LongRange::Settings settings;
+        Vec3 from(0.f, 0.f, 0.f);
+        auto plan = LongRange::BuildPlan(from, Vec3(24000.f, 0.f, 0.f), 8.f, settings);
+
+        bool isAtBoundaries = true;
+        for (size_t i = 0; i < plan.stageCount; ++i) {
+            float mid = 0.5f * (plan.stages[i].startTime + plan.stages[i].endTime);
+            isAtBoundaries = isAtBoundaries && plan.GetStage(plan.stages[i].startTime) == i && plan.GetStage(mid) == i;
+        }
+        Check(isAtBoundaries, "GetStage: each stage from its start time");
+        Check(plan.GetStage(-1.f) == 0, "GetStage: before the start is the first stage");
+        Check(plan.GetStage(plan.duration) == plan.stageCount - 1, "GetStage: at the end is the last stage");
+        Check(plan.GetStage(plan.duration + 5.f) == plan.stageCount - 1, "GetStage: after the end is the last stage");
+        Check(LongRange::Plan().GetStage(1.f) == 0, "GetStage: empty plan");
+    }
+
+    void TestDegenerate() {
+        LongRange::Settings settings;
+        Vec3 point(500.f, 500.f, 500.f);
+
+        auto still = LongRange::BuildPlan(point, point, 2.f, settings);
+        Check(still.stageCount == 1 && Length(still.stages[0].end - point) == 0.f && still.stages[0].endTime == 2.f, "degenerate: no distance");
+        Check(IsFinite(still), "degenerate: no distance is finite");
+
+        auto instant = LongRange::BuildPlan(point, point + Vec3(0.f, 30000.f, 0.f), 0.f, settings);
+        Check(IsFinite(instant) && instant.stages[instant.stageCount - 1].endTime == 0.f, "degenerate: zero duration");
+
+        LongRange::Settings zeroLength;
+        zeroLength.stageLength = 0.f;
+        auto clamped = LongRange::BuildPlan(point, point + Vec3(100.f, 0.f, 0.f), 1.f, zeroLength);
+        Check(clamped.stageCount == LongRange::kMaxStages, "degenerate: zero stageLength is capped");
+        CheckTiming(clamped, point, "zero stageLength");
+    }
+}
+
+int main() {
+    TestStageCount();
+    TestArc();
+    TestGetStage();
+    TestDegenerate();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
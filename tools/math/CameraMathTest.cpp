@@ -0,0 +1,202 @@
+// Checks CameraMath at the edges the camera hits in game: looking straight up or down (pitch +-90 degrees,
+// where yaw is undefined), yaw wrapping across +-180 degrees, blends next to the pole, batch angle wrapping
+// against the scalar reference, and exact conversion to and from the RE types.
+// Exits non-zero if any check fails.
+#include "CameraMath.h"
+
+#include <cstdio>
+#include <random>
+
+using namespace SecondSight::CameraMath;
+
+namespace {
+    int g_failures = 0;
+    constexpr float kDeg = kPi / 180.f;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    bool Near(float a_value, float a_expected, float a_tolerance = 1e-4f) {
+        return std::abs(a_value - a_expected) <= a_tolerance;
+    }
+
+    // equal modulo a full turn
+    bool NearAngle(float a_value, float a_expected, float a_tolerance = 1e-4f) {
+        return std::abs(NormalizeAngle(a_value - a_expected)) <= a_tolerance;
+    }
+
+    bool Near(const Vec3& a_value, const Vec3& a_expected, float a_tolerance = 1e-4f) {
+        return Length(a_value - a_expected) <= a_tolerance;
+    }
+
+    // _ts_SKSEFunctions::NormalRelativeAngle, which the manager used before
+    float NormalRelativeAngle(float a_angle) {
+        while (a_angle > kPi) {
+            a_angle -= kTwoPi;
+        }
+        while (a_angle < -kPi) {
+            a_angle += kTwoPi;
+        }
+        return a_angle;
+    }
+
+    void TestConvention() {
+        Check(Near(ForwardFromPitchYaw(0.f, 0.f), Vec3(0.f, 1.f, 0.f)), "convention: yaw 0 looks along +Y");
+        Check(Near(ForwardFromPitchYaw(0.f, kPi / 2.f), Vec3(1.f, 0.f, 0.f)), "convention: yaw 90 looks along +X");
+        Check(Near(ForwardFromPitchYaw(kPi / 2.f, 0.f), Vec3(0.f, 0.f, -1.f)), "convention: pitch +90 looks down");
+        Check(Near(ForwardFromPitchYaw(-kPi / 2.f, 0.f), Vec3(0.f, 0.f, 1.f)), "convention: pitch -90 looks up");
+
+        std::mt19937 rng(3);
+        std::uniform_real_distribution<float> pitch(-kPi / 2.f, kPi / 2.f);
+        std::uniform_real_distribution<float> yaw(-kPi, kPi);
+        bool isConsistent = true;
+        for (int i = 0; i < 10000; ++i) {
+            PitchYaw rotation{ pitch(rng), yaw(rng) };
+            auto forward = ForwardFromPitchYaw(rotation.pitch, rotation.yaw);
+            isConsistent = isConsistent && Near(Quat::FromPitchYaw(rotation).Forward(), forward, 1e-5f);
+        }
+        Check(isConsistent, "convention: quaternion forward matches ForwardFromPitchYaw");
+    }
+
+    void TestGimbal() {
+        // straight up at a tall creature, straight down from a ledge: yaw is undefined, keep the fallback
+        auto up = LookAt(Vec3(0.f, 0.f, 5000.f), 1.2f);
+        Check(Near(up.pitch, -kPi / 2.f) && Near(up.yaw, 1.2f), "gimbal: LookAt straight up keeps the fallback yaw");
+        auto down = LookAt(Vec3(0.f, 0.f, -5000.f), -2.5f);
+        Check(Near(down.pitch, kPi / 2.f) && Near(down.yaw, -2.5f), "gimbal: LookAt straight down keeps the fallback yaw");
+        auto zero = LookAt(Vec3(), 0.7f);
+        Check(Near(zero.yaw, 0.7f) && !std::isnan(zero.pitch), "gimbal: LookAt of a zero vector is finite");
+
+        // the quaternion round trip at and next to the poles, for yaws all around
+        bool isExact = true;
+        bool isStable = true;
+        for (float yawDegrees = -180.f; yawDegrees <= 180.f; yawDegrees += 7.5f) {
+            float yaw = yawDegrees * kDeg;
+            for (float pitch : { -kPi / 2.f, kPi / 2.f }) {
+                auto result = Quat::FromPitchYaw({ pitch, yaw }).ToPitchYaw();
+                isExact = isExact && Near(result.pitch, pitch, 2e-3f) && NearAngle(result.yaw, yaw, 1e-3f);
+            }
+            for (float pitch : { -89.99f * kDeg, 89.99f * kDeg, -89.f * kDeg, 89.f * kDeg }) {
+                auto result = Quat::FromPitchYaw({ pitch, yaw }).ToPitchYaw();
+                isStable = isStable && Near(result.pitch, pitch, 2e-3f) && NearAngle(result.yaw, yaw, 1e-3f);
+            }
+        }
+        Check(isExact, "gimbal: pitch +-90 keeps its yaw through the quaternion");
+        Check(isStable, "gimbal: yaw does not flip next to the poles");
+
+        // turning around while looking almost straight up turns about the vertical, without rolling over the pole
+        bool isLevel = true;
+        for (float t = 0.f; t <= 1.f; t += 0.125f) {
+            auto turn = Slerp(PitchYaw{ -80.f * kDeg, 0.f }, PitchYaw{ -80.f * kDeg, kPi }, t);
+            isLevel = isLevel && Near(turn.pitch, -80.f * kDeg, 1e-3f);
+        }
+        Check(isLevel, "gimbal: half turn next to the pole keeps the pitch");
+
+        // from straight up down to the horizon: finite, and the pitch falls steadily
+        bool isMonotonic = true;
+        float previous = -kPi / 2.f - 1e-3f;
+        for (float t = 0.f; t <= 1.f; t += 0.0625f) {
+            auto blend = Slerp(PitchYaw{ -kPi / 2.f, 0.f }, PitchYaw{ 0.f, kPi / 2.f }, t);
+            isMonotonic = isMonotonic && !std::isnan(blend.pitch) && !std::isnan(blend.yaw) && blend.pitch >= previous - 1e-4f;
+            previous = blend.pitch;
+        }
+        Check(isMonotonic, "gimbal: blend from straight up to the horizon is finite and monotonic");
+    }
+
+    void TestYawWrap() {
+        // 179 to -179 degrees is a 2 degree turn, not 358
+        auto mid = Slerp(PitchYaw{ 0.f, 179.f * kDeg }, PitchYaw{ 0.f, -179.f * kDeg }, 0.5f);
+        Check(NearAngle(mid.yaw, kPi, 1e-3f), "yaw wrap: blend across 180 takes the short way");
+        auto quarter = Slerp(PitchYaw{ 0.f, 179.f * kDeg }, PitchYaw{ 0.f, -179.f * kDeg }, 0.25f);
+        Check(NearAngle(quarter.yaw, 179.5f * kDeg, 1e-3f), "yaw wrap: blend progresses linearly in angle");
+
+        // unwrapped inputs are the same rotation
+        auto wrapped = Slerp(PitchYaw{ 0.2f, 10.f * kDeg + 4.f * kTwoPi }, PitchYaw{ 0.2f, 30.f * kDeg - 3.f * kTwoPi }, 0.5f);
+        Check(NearAngle(wrapped.yaw, 20.f * kDeg, 1e-3f) && Near(wrapped.pitch, 0.2f, 2e-3f), "yaw wrap: extra turns in the inputs are ignored");
+
+        // endpoints
+        PitchYaw from{ 0.3f, -3.f };
+        PitchYaw to{ -0.4f, 3.f };
+        auto start = Slerp(from, to, 0.f);
+        auto end = Slerp(from, to, 1.f);
+        Check(Near(start.pitch, from.pitch, 1e-3f) && NearAngle(start.yaw, from.yaw, 1e-3f), "yaw wrap: t = 0 is the start");
+        Check(Near(end.pitch, to.pitch, 1e-3f) && NearAngle(end.yaw, to.yaw, 1e-3f), "yaw wrap: t = 1 is the end");
+    }
+
+    void TestNormalizeAngles() {
+        Check(Near(NormalizeAngle(kPi + 0.1f), -kPi + 0.1f), "wrap: just past +180");
+        Check(Near(NormalizeAngle(-kPi - 0.1f), kPi - 0.1f), "wrap: just past -180");
+        Check(Near(NormalizeAngle(100.f * kPi + 0.25f), 0.25f, 1e-3f), "wrap: many turns");
+
+        // the batch version against the scalar reference, including the scalar tail
+        std::mt19937 rng(5);
+        std::uniform_real_distribution<float> angle(-40.f, 40.f);
+        float angles[1027];
+        float reference[1027];
+        for (size_t i = 0; i < std::size(angles); ++i) {
+            angles[i] = reference[i] = angle(rng);
+        }
+        angles[0] = reference[0] = kPi;
+        angles[1] = reference[1] = -kPi;
+        NormalizeAngles(angles, std::size(angles));
+
+        bool isInRange = true;
+        bool isSameAngle = true;
+        for (size_t i = 0; i < std::size(angles); ++i) {
+            isInRange = isInRange && angles[i] >= -kPi - 1e-5f && angles[i] <= kPi + 1e-5f;
+            isSameAngle = isSameAngle && NearAngle(angles[i], NormalRelativeAngle(reference[i]), 1e-5f);
+        }
+        Check(isInRange, "wrap: batch results within [-pi, pi]");
+        Check(isSameAngle, "wrap: batch matches the scalar reference");
+    }
+
+    void TestConversion() {
+        struct Point3 {
+            float x, y, z;
+        };
+        struct Point2 {
+            float x, y;
+        };
+
+        Point3 point{ 12345.678f, -0.000123f, 3.4e38f };
+        auto back = Vec3::From(point).To<Point3>();
+        Check(back.x == point.x && back.y == point.y && back.z == point.z, "conversion: NiPoint3 round trip is exact");
+
+        Point2 rotation{ 1.5707964f, -3.1415927f };
+        auto rotationBack = PitchYaw::From(rotation).To<Point2>();
+        Check(rotationBack.x == rotation.x && rotationBack.y == rotation.y, "conversion: BSTPoint2 round trip is exact");
+    }
+
+    void TestSquad() {
+        // with the endpoints as control points squad is slerp
+        auto q0 = Quat::FromPitchYaw({ 0.3f, -1.f });
+        auto q1 = Quat::FromPitchYaw({ -0.6f, 2.f });
+        bool isSlerp = true;
+        for (float t = 0.f; t <= 1.f; t += 0.125f) {
+            auto squad = Squad(q0, q0, q1, q1, t);
+            auto slerp = Slerp(q0, q1, t);
+            isSlerp = isSlerp && std::abs(std::abs(Dot(squad, slerp)) - 1.f) < 1e-4f;
+        }
+        Check(isSlerp, "squad: endpoint control points reduce to slerp");
+    }
+}
+
+int main() {
+    TestConvention();
+    TestGimbal();
+    TestYawWrap();
+    TestNormalizeAngles();
+    TestConversion();
+    TestSquad();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,375 @@
+// Headless test of TraceRecorder. A stand-in FCFW plays timelines on a simulated clock and delivers
+// kPlaybackStart/Wait/Stop to a stand-in manager, both instrumented with the event names the plugin uses,
+// and the dump is read back. Checks that nothing is recorded while disabled, that a cast produces the
+// lifecycle in order with balanced begin/end pairs, that the ring keeps the newest kCapacity events in
+// order, and that events from several threads are kept apart. Prints the cost per call.
+// Exits non-zero if any check fails.
+#include "TraceRecorder.h"
+
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <functional>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace SecondSight;
+
+namespace {
+    int g_failures = 0;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    enum class Message {
+        kPlaybackStart,
+        kPlaybackStop,
+        kPlaybackWait
+    };
+
+    // The part of FCFW_API::IVFCFW1 a cast goes through, with playback on a simulated clock
+    class StandInFCFW {
+        public:
+            using Handler = std::function<void(Message, size_t)>;
+
+            explicit StandInFCFW(Handler a_handler) : m_handler(std::move(a_handler)) {}
+
+            size_t RegisterTimeline() {
+                TraceScope scope("FCFW::RegisterTimeline");
+                m_durations.push_back(0.f);
+                return m_durations.size();
+            }
+
+            void ClearTimeline(size_t a_timelineID) {
+                TraceScope scope("FCFW::ClearTimeline");
+                m_durations[a_timelineID - 1] = 0.f;
+            }
+
+            void SetDuration(size_t a_timelineID, float a_duration) { m_durations[a_timelineID - 1] = a_duration; }
+
+            bool StartPlayback(size_t a_timelineID) {
+                TraceScope scope("FCFW::StartPlayback");
+                m_active = a_timelineID;
+                m_time = 0.f;
+                m_isWaiting = false;
+                m_handler(Message::kPlaybackStart, a_timelineID);
+                return true;
+            }
+
+            bool SwitchPlayback(size_t a_from, size_t a_to) {
+                TraceScope scope("FCFW::SwitchPlayback");
+                if (m_active != a_from) {
+                    return false;
+                }
+                m_active = a_to;
+                m_time = 0.f;
+                m_isWaiting = false;
+                return true;
+            }
+
+            void StopPlayback() {
+                auto timelineID = m_active;
+                m_active = 0;
+                m_handler(Message::kPlaybackStop, timelineID);
+            }
+
+            size_t GetActiveTimelineID() const { return m_active; }
+
+            // Transition timelines end in kWait, the at-target timeline loops
+            void Update(float a_delta, size_t a_waitTimelineID) {
+                if (m_active == 0 || m_isWaiting) {
+                    return;
+                }
+                m_time += a_delta;
+                if (m_active == a_waitTimelineID && m_time >= m_durations[m_active - 1]) {
+                    m_isWaiting = true;
+                    m_handler(Message::kPlaybackWait, m_active);
+                }
+            }
+
+        private:
+            Handler m_handler;
+            std::vector<float> m_durations;
+            size_t m_active = 0;
+            float m_time = 0.f;
+            bool m_isWaiting = false;
+    };
+
+    // FreeCameraManager's side of a cast, reduced to its trace points
+    class StandInManager {
+        public:
+            StandInManager() : m_fcfw([this](Message a_message, size_t a_timelineID) { OnMessage(a_message, a_timelineID); }) {
+                m_timeline1 = m_fcfw.RegisterTimeline();
+                m_timeline2 = m_fcfw.RegisterTimeline();
+                m_timeline3 = m_fcfw.RegisterTimeline();
+            }
+
+            bool Cast() {
+                TraceScope scope("Papyrus::StartSecondSightEffect");
+                {
+                    TraceScope updateTarget("UpdateTarget");
+                }
+                {
+                    TraceScope build("UpdateTimeline1");
+                    m_fcfw.ClearTimeline(m_timeline1);
+                    m_fcfw.SetDuration(m_timeline1, 1.2f);
+                }
+                {
+                    TraceScope build("UpdateTimeline2");
+                    m_fcfw.ClearTimeline(m_timeline2);
+                    m_fcfw.SetDuration(m_timeline2, 10.f);
+                }
+                return m_fcfw.StartPlayback(m_timeline1);
+            }
+
+            void Stop() {
+                TraceScope scope("Papyrus::StopSecondSightEffect");
+                {
+                    TraceScope build("UpdateTimeline3");
+                    m_fcfw.ClearTimeline(m_timeline3);
+                    m_fcfw.SetDuration(m_timeline3, 1.f);
+                }
+                m_fcfw.SwitchPlayback(m_fcfw.GetActiveTimelineID(), m_timeline3);
+                m_fcfw.StopPlayback();
+            }
+
+            void Update(float a_delta) { m_fcfw.Update(a_delta, m_timeline1); }
+
+            size_t GetTimeline1() const { return m_timeline1; }
+            size_t GetTimeline3() const { return m_timeline3; }
+
+        private:
+            void OnMessage(Message a_message, size_t a_timelineID) {
+                auto& trace = TraceRecorder::GetSingleton();
+                switch (a_message) {
+                case Message::kPlaybackStart:
+                    trace.Instant("FCFW::kPlaybackStart", a_timelineID);
+                    break;
+                case Message::kPlaybackStop:
+                    trace.Instant("FCFW::kPlaybackStop", a_timelineID);
+                    break;
+                case Message::kPlaybackWait:
+                    trace.Instant("FCFW::kPlaybackWait", a_timelineID);
+                    if (a_timelineID == m_timeline1) {
+                        m_fcfw.SwitchPlayback(m_timeline1, m_timeline2);
+                    }
+                    break;
+                }
+            }
+
+            StandInFCFW m_fcfw;
+            size_t m_timeline1 = 0;
+            size_t m_timeline2 = 0;
+            size_t m_timeline3 = 0;
+    };
+
+    struct Event {
+        std::string name;
+        char phase = 0;
+        long long timestamp = 0;
+        unsigned long long threadID = 0;
+        unsigned long long value = 0;
+    };
+
+    std::string Field(const std::string& a_line, const char* a_key) {
+        auto key = std::string("\"") + a_key + "\":";
+        auto pos = a_line.find(key);
+        if (pos == std::string::npos) {
+            return {};
+        }
+        pos += key.size();
+        if (a_line[pos] == '"') {
+            return a_line.substr(pos + 1, a_line.find('"', pos + 1) - pos - 1);
+        }
+        return a_line.substr(pos, a_line.find_first_of(",}", pos) - pos);
+    }
+
+    // The dump writes one event per line
+    std::vector<Event> DumpAndRead() {
+        auto path = std::filesystem::temp_directory_path() / "SecondSight_trace_test.json";
+        Check(TraceRecorder::GetSingleton().Dump(path), "dump: file written");
+
+        std::vector<Event> events;
+        std::ifstream file(path);
+        std::string line;
+        std::getline(file, line);
+        Check(line.rfind("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", 0) == 0, "dump: trace_event header");
+        while (std::getline(file, line)) {
+            if (line.rfind("{\"name\"", 0) != 0) {
+                continue;
+            }
+            Event event;
+            event.name = Field(line, "name");
+            event.phase = Field(line, "ph")[0];
+            event.timestamp = std::atoll(Field(line, "ts").c_str());
+            event.threadID = std::strtoull(Field(line, "tid").c_str(), nullptr, 10);
+            event.value = std::strtoull(Field(line, "value").c_str(), nullptr, 10);
+            events.push_back(event);
+        }
+        std::filesystem::remove(path);
+        return events;
+    }
+
+    void RunCast(StandInManager& a_manager) {
+        a_manager.Cast();
+        for (int frame = 0; frame < 120; ++frame) {
+            a_manager.Update(1.f / 60.f);
+        }
+        a_manager.Stop();
+    }
+
+    void TestDisabled() {
+        auto& trace = TraceRecorder::GetSingleton();
+        trace.SetEnabled(false);
+        StandInManager manager;
+        RunCast(manager);
+        Check(DumpAndRead().empty(), "disabled: nothing recorded");
+    }
+
+    void TestLifecycle() {
+        auto& trace = TraceRecorder::GetSingleton();
+        trace.SetEnabled(true);
+        StandInManager manager;
+        RunCast(manager);
+        auto events = DumpAndRead();
+        trace.SetEnabled(false);
+
+        // begin/end pairs nest, timestamps never go back
+        std::vector<std::string> stack;
+        bool isNested = true;
+        bool isOrdered = true;
+        for (size_t i = 0; i < events.size(); ++i) {
+            auto& event = events[i];
+            if (event.phase == 'B') {
+                stack.push_back(event.name);
+            } else if (event.phase == 'E') {
+                isNested = isNested && !stack.empty() && stack.back() == event.name;
+                if (!stack.empty()) {
+                    stack.pop_back();
+                }
+            }
+            isOrdered = isOrdered && (i == 0 || event.timestamp >= events[i - 1].timestamp);
+        }
+        Check(isNested && stack.empty(), "lifecycle: begin/end pairs nest");
+        Check(isOrdered, "lifecycle: timestamps are monotonic");
+
+        // the steps of a cast, in order
+        const std::vector<std::pair<std::string, char>> expected = {
+            { "Papyrus::StartSecondSightEffect", 'B' },
+            { "UpdateTarget", 'B' },
+            { "UpdateTimeline1", 'B' },
+            { "FCFW::ClearTimeline", 'B' },
+            { "UpdateTimeline2", 'B' },
+            { "FCFW::StartPlayback", 'B' },
+            { "FCFW::kPlaybackStart", 'i' },
+            { "Papyrus::StartSecondSightEffect", 'E' },
+            { "FCFW::kPlaybackWait", 'i' },
+            { "FCFW::SwitchPlayback", 'B' },
+            { "Papyrus::StopSecondSightEffect", 'B' },
+            { "UpdateTimeline3", 'B' },
+            { "FCFW::SwitchPlayback", 'B' },
+            { "FCFW::kPlaybackStop", 'i' },
+            { "Papyrus::StopSecondSightEffect", 'E' }
+        };
+        size_t matched = 0;
+        for (auto& event : events) {
+            if (matched < expected.size() && event.name == expected[matched].first && event.phase == expected[matched].second) {
+                ++matched;
+            }
+        }
+        Check(matched == expected.size(), "lifecycle: all steps recorded in order");
+
+        for (auto& event : events) {
+            if (event.name == "FCFW::kPlaybackStart" || event.name == "FCFW::kPlaybackWait") {
+                Check(event.value == manager.GetTimeline1(), "lifecycle: arrival carries the transition timeline");
+            } else if (event.name == "FCFW::kPlaybackStop") {
+                Check(event.value == manager.GetTimeline3(), "lifecycle: stop carries the return timeline");
+            }
+        }
+    }
+
+    void TestRing() {
+        auto& trace = TraceRecorder::GetSingleton();
+        trace.SetEnabled(true);
+        constexpr std::uint64_t kExtra = 100;
+        for (std::uint64_t i = 0; i < TraceRecorder::kCapacity + kExtra; ++i) {
+            trace.Instant("Ring", i);
+        }
+        auto events = DumpAndRead();
+        Check(events.size() == TraceRecorder::kCapacity, "ring: holds kCapacity events");
+        bool isConsecutive = !events.empty() && events.front().value == kExtra;
+        for (size_t i = 1; i < events.size(); ++i) {
+            isConsecutive = isConsecutive && events[i].value == events[i - 1].value + 1;
+        }
+        Check(isConsecutive, "ring: the newest events, oldest first");
+
+        // re-enabling starts a new trace
+        trace.SetEnabled(false);
+        trace.SetEnabled(true);
+        Check(DumpAndRead().empty(), "ring: re-enabling clears");
+        trace.SetEnabled(false);
+    }
+
+    void TestThreads() {
+        auto& trace = TraceRecorder::GetSingleton();
+        trace.SetEnabled(true);
+        auto record = [&trace]() {
+            for (int i = 0; i < 1000; ++i) {
+                trace.Instant("Thread");
+            }
+        };
+        std::thread first(record);
+        std::thread second(record);
+        first.join();
+        second.join();
+        auto events = DumpAndRead();
+        trace.SetEnabled(false);
+
+        std::map<unsigned long long, size_t> perThread;
+        for (auto& event : events) {
+            ++perThread[event.threadID];
+        }
+        Check(events.size() == 2000, "threads: every event recorded");
+        Check(perThread.size() == 2 && perThread.begin()->second == 1000, "threads: events attributed per thread");
+    }
+
+    void MeasureOverhead() {
+        auto& trace = TraceRecorder::GetSingleton();
+        constexpr int kCalls = 10000000;
+        auto measure = [&]() {
+            auto start = std::chrono::steady_clock::now();
+            for (int i = 0; i < kCalls; ++i) {
+                trace.Instant("Overhead", static_cast<std::uint64_t>(i));
+            }
+            return std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count() / kCalls;
+        };
+        trace.SetEnabled(false);
+        double disabled = measure();
+        trace.SetEnabled(true);
+        double enabled = measure();
+        trace.SetEnabled(false);
+        std::printf("Instant: %.2f ns/call disabled, %.2f ns/call enabled\n", disabled, enabled);
+    }
+}
+
+int main() {
+    TestDisabled();
+    TestLifecycle();
+    TestRing();
+    TestThreads();
+    MeasureOverhead();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}
@@ -0,0 +1,209 @@
+// Checks CameraTrack, the keyframed channel of the built-in camera driver: key ordering and duration,
+// linear, stepped and Catmull-Rom interpolation, the easing flags on a key's incoming segment, and rotation
+// tracks taking the short way across +-180 degrees of yaw.
+// Exits non-zero if any check fails.
+#include "CameraTrack.h"
+
+#include <cstdio>
+
+using namespace SecondSight;
+using CameraMath::Vec3;
+using Key = CameraTrack::Key;
+using Interpolation = CameraTrack::Interpolation;
+
+namespace {
+    int g_failures = 0;
+    constexpr float kDeg = CameraMath::kPi / 180.f;
+
+    void Check(bool a_condition, const char* a_what) {
+        if (!a_condition) {
+            std::fprintf(stderr, "FAILED: %s\n", a_what);
+            ++g_failures;
+        }
+    }
+
+    bool Near(float a_value, float a_expected, float a_tolerance = 1e-4f) {
+        return std::abs(a_value - a_expected) <= a_tolerance;
+    }
+
+    bool Near(const Vec3& a_value, const Vec3& a_expected, float a_tolerance = 1e-3f) {
+        return CameraMath::Length(a_value - a_expected) <= a_tolerance;
+    }
+
+    Key MakeKey(float a_time, const Vec3& a_value, Interpolation a_interpolation = Interpolation::kCubicHermite, bool a_easeIn = false, bool a_easeOut = false) {
+        Key key;
+        key.time = a_time;
+        key.value = a_value;
+        key.interpolation = a_interpolation;
+        key.easeIn = a_easeIn;
+        key.easeOut = a_easeOut;
+        return key;
+    }
+
+    void TestKeys() {
+        CameraTrack track;
+        Check(track.GetDuration() == 0.f && Near(track.Evaluate(1.f), Vec3()), "keys: empty track");
+
+        track.Add(MakeKey(2.f, Vec3(2.f, 0.f, 0.f)));
+        track.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        size_t index = track.Add(MakeKey(1.f, Vec3(1.f, 0.f, 0.f)));
+        Check(index == 1, "keys: Add returns the sorted index");
+        size_t same = track.Add(MakeKey(1.f, Vec3(5.f, 0.f, 0.f)));
+        Check(same == 2 && track.GetKey(1).value.X() == 1.f, "keys: a key at the same time goes after the existing one");
+        Check(track.GetCount() == 4 && track.GetDuration() == 2.f, "keys: duration is the last key's time");
+
+        Check(track.Remove(2) && track.GetCount() == 3, "keys: Remove");
+        Check(!track.Remove(3), "keys: Remove out of range");
+        Check(track.Remove(2) && track.GetDuration() == 1.f, "keys: duration follows the last key");
+
+        track.SetValue(1, Vec3(9.f, 0.f, 0.f));
+        Check(Near(track.Evaluate(1.f), Vec3(9.f, 0.f, 0.f)), "keys: SetValue");
+        track.Clear();
+        Check(track.GetCount() == 0 && track.GetDuration() == 0.f, "keys: Clear");
+    }
+
+    void TestInterpolation() {
+        CameraTrack linear;
+        linear.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        linear.Add(MakeKey(2.f, Vec3(100.f, -50.f, 20.f), Interpolation::kLinear));
+        Check(Near(linear.Evaluate(0.5f), Vec3(25.f, -12.5f, 5.f)), "interpolation: linear");
+        Check(Near(linear.Evaluate(-1.f), Vec3(0.f, 0.f, 0.f)), "interpolation: clamped before the first key");
+        Check(Near(linear.Evaluate(3.f), Vec3(100.f, -50.f, 20.f)), "interpolation: clamped after the last key");
+
+        CameraTrack stepped;
+        stepped.Add(MakeKey(0.f, Vec3(1.f, 1.f, 1.f)));
+        stepped.Add(MakeKey(1.f, Vec3(2.f, 2.f, 2.f), Interpolation::kNone));
+        Check(Near(stepped.Evaluate(0.99f), Vec3(1.f, 1.f, 1.f)) && Near(stepped.Evaluate(1.f), Vec3(2.f, 2.f, 2.f)), "interpolation: none holds until the key");
+
+        // Catmull-Rom passes through the keys, and reproduces a straight line at constant speed
+        CameraTrack cubic;
+        for (int i = 0; i < 5; ++i) {
+            cubic.Add(MakeKey(i * 0.5f, Vec3(i * 10.f, i * -4.f, 3.f)));
+        }
+        bool isLinear = true;
+        for (float t = 0.f; t <= 2.f; t += 0.05f) {
+            isLinear = isLinear && Near(cubic.Evaluate(t), Vec3(t * 20.f, t * -8.f, 3.f));
+        }
+        Check(isLinear, "interpolation: cubic reproduces a line through evenly spaced keys");
+
+        CameraTrack curve;
+        curve.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        curve.Add(MakeKey(1.f, Vec3(100.f, 0.f, 50.f)));
+        curve.Add(MakeKey(3.f, Vec3(100.f, 200.f, 0.f)));
+        curve.Add(MakeKey(3.5f, Vec3(0.f, 200.f, 10.f)));
+        bool isThroughKeys = true;
+        for (size_t i = 0; i < curve.GetCount(); ++i) {
+            isThroughKeys = isThroughKeys && Near(curve.Evaluate(curve.GetKey(i).time), curve.GetKey(i).value);
+        }
+        Check(isThroughKeys, "interpolation: cubic passes through its keys");
+
+        // no jumps at the keys, with uneven key spacing
+        bool isContinuous = true;
+        for (size_t i = 1; i + 1 < curve.GetCount(); ++i) {
+            float time = curve.GetKey(i).time;
+            isContinuous = isContinuous && Near(curve.Evaluate(time - 1e-3f), curve.Evaluate(time + 1e-3f), 1.f);
+        }
+        Check(isContinuous, "interpolation: cubic is continuous across keys");
+    }
+
+    void TestEasing() {
+        Check(CameraTrack::Ease(0.f, true, true) == 0.f && CameraTrack::Ease(1.f, true, true) == 1.f, "easing: endpoints fixed");
+        Check(Near(CameraTrack::Ease(0.5f, false, false), 0.5f), "easing: none is linear");
+        Check(Near(CameraTrack::Ease(0.5f, true, false), 0.25f), "easing: ease in starts slowly");
+        Check(Near(CameraTrack::Ease(0.5f, false, true), 0.75f), "easing: ease out ends slowly");
+        Check(Near(CameraTrack::Ease(0.5f, true, true), 0.5f) && CameraTrack::Ease(0.1f, true, true) < 0.1f, "easing: both is smoothstep");
+        Check(CameraTrack::Ease(-1.f, false, false) == 0.f && CameraTrack::Ease(2.f, false, false) == 1.f, "easing: clamped to [0, 1]");
+
+        bool isMonotonic = true;
+        for (int flags = 0; flags < 4; ++flags) {
+            float previous = 0.f;
+            for (float t = 0.f; t <= 1.f; t += 0.01f) {
+                float value = CameraTrack::Ease(t, flags & 1, flags & 2);
+                isMonotonic = isMonotonic && value >= previous;
+                previous = value;
+            }
+        }
+        Check(isMonotonic, "easing: monotonic");
+
+        // the flags of a key shape its incoming segment only
+        CameraTrack track;
+        track.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        track.Add(MakeKey(1.f, Vec3(100.f, 0.f, 0.f), Interpolation::kLinear, true, false));
+        track.Add(MakeKey(2.f, Vec3(200.f, 0.f, 0.f), Interpolation::kLinear));
+        Check(Near(track.Evaluate(0.5f).X(), 25.f, 1e-2f), "easing: ease in on the key's incoming segment");
+        Check(Near(track.Evaluate(1.5f).X(), 150.f, 1e-2f), "easing: next segment unaffected");
+    }
+
+    void TestRotationWrap() {
+        // yaw 170 -> -170 degrees turns 20 degrees through 180, not 340 through 0
+        CameraTrack track(true);
+        track.Add(MakeKey(0.f, Vec3(0.1f, 170.f * kDeg, 0.f), Interpolation::kLinear));
+        track.Add(MakeKey(1.f, Vec3(-0.1f, -170.f * kDeg, 0.f), Interpolation::kLinear));
+        auto mid = track.Evaluate(0.5f);
+        Check(Near(std::abs(mid.Y()), CameraMath::kPi, 1e-3f) && Near(mid.X(), 0.f), "rotation: linear yaw crosses 180 the short way");
+        auto quarter = track.Evaluate(0.25f);
+        Check(Near(quarter.Y(), 175.f * kDeg, 1e-3f), "rotation: yaw moves evenly");
+
+        // a cubic track turning on past 180 stays on the short path and within [-pi, pi]
+        CameraTrack turn(true);
+        for (int i = 0; i < 6; ++i) {
+            float yaw = CameraMath::NormalizeAngle((150.f + i * 15.f) * kDeg);
+            turn.Add(MakeKey(static_cast<float>(i), Vec3(0.f, yaw, 0.f)));
+        }
+        bool isShortWay = true;
+        bool isInRange = true;
+        for (float t = 0.f; t <= 5.f; t += 0.05f) {
+            auto rotation = turn.Evaluate(t);
+            float expected = CameraMath::NormalizeAngle((150.f + t * 15.f) * kDeg);
+            isShortWay = isShortWay && std::abs(CameraMath::NormalizeAngle(rotation.Y() - expected)) < 1e-3f;
+            isInRange = isInRange && rotation.Y() >= -CameraMath::kPi - 1e-5f && rotation.Y() <= CameraMath::kPi + 1e-5f;
+            isInRange = isInRange && rotation.Z() == 0.f;
+        }
+        Check(isShortWay, "rotation: cubic yaw follows the turn across 180");
+        Check(isInRange, "rotation: yaw normalized, no roll");
+
+        // a translation track does not wrap
+        CameraTrack translation;
+        translation.Add(MakeKey(0.f, Vec3(0.f, 3.f, 0.f)));
+        translation.Add(MakeKey(1.f, Vec3(0.f, -3.f, 0.f), Interpolation::kLinear));
+        Check(Near(translation.Evaluate(0.5f).Y(), 0.f), "rotation: translation tracks are not wrapped");
+    }
+
+    void TestDuration() {
+        CameraTrack track;
+        track.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        track.Add(MakeKey(4.f, Vec3(40.f, 0.f, 0.f), Interpolation::kLinear));
+        Check(track.GetDuration() == 4.f, "duration: last key time");
+        Check(Near(track.Evaluate(track.GetDuration()), Vec3(40.f, 0.f, 0.f)), "duration: ends on the last key");
+
+        // a later key extends the track, an earlier one does not
+        track.Add(MakeKey(6.f, Vec3(60.f, 0.f, 0.f), Interpolation::kLinear));
+        track.Add(MakeKey(1.f, Vec3(10.f, 0.f, 0.f), Interpolation::kLinear));
+        Check(track.GetDuration() == 6.f, "duration: extended by a later key only");
+        Check(Near(track.Evaluate(5.f), Vec3(50.f, 0.f, 0.f)), "duration: evaluates into the extension");
+
+        // two keys at one time: a cut, the later key wins from then on
+        CameraTrack cut;
+        cut.Add(MakeKey(0.f, Vec3(0.f, 0.f, 0.f)));
+        cut.Add(MakeKey(1.f, Vec3(10.f, 0.f, 0.f), Interpolation::kLinear));
+        cut.Add(MakeKey(1.f, Vec3(500.f, 0.f, 0.f), Interpolation::kLinear));
+        cut.Add(MakeKey(2.f, Vec3(510.f, 0.f, 0.f), Interpolation::kLinear));
+        Check(Near(cut.Evaluate(0.5f).X(), 5.f) && Near(cut.Evaluate(1.5f).X(), 505.f), "duration: keys at the same time cut");
+        Check(cut.GetDuration() == 2.f, "duration: a cut does not add time");
+    }
+}
+
+int main() {
+    TestKeys();
+    TestInterpolation();
+    TestEasing();
+    TestRotationWrap();
+    TestDuration();
+
+    if (g_failures > 0) {
+        std::fprintf(stderr, "%d checks failed\n", g_failures);
+        return 1;
+    }
+    std::printf("all checks passed\n");
+    return 0;
+}